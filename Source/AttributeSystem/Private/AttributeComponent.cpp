@@ -6,29 +6,45 @@
 #include "Engine/Engine.h"
 #include "AttributeData.h"
 #include "AttributeSaveGame.h"
+#include "AttributeTelemetry.h"
+#include "AttributeSystemStats.h"
+#include "AttributeQuerySubsystem.h"
+#include "AttributeUpdateSubsystem.h"
+#include "AttributeDormantStateSubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeComponent)
 
 UAttributeComponent::UAttributeComponent(const FObjectInitializer& ObjectInitializer)
-    : Super(ObjectInitializer), DefaultSaveSlotName(TEXT("AttributeSaveSlot")), DefaultUserIndex(0)
+    : Super(ObjectInitializer), bAttributesReady(false), bAttributesLoading(false), QuerySubsystem(nullptr), UpdateSubsystem(nullptr), NextModifierHandle(0), DormantSubsystem(nullptr), TelemetryActorId(0), bDeterministic(false), SimulationTickRate(30), bPersistWhenStreamedOut(true), DefaultSaveSlotName(TEXT("AttributeSaveSlot")), DefaultUserIndex(0), SimulationTick(0), StateChecksum(0)
 {
     PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UAttributeComponent::LoadAttributesFromDataAsset()
 {
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_LoadFromDataAsset);
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
     if (AttributeDataAsset)
     {
+        StopAllRegen();
+        DeterministicStates.Reset();
+        RegenElapsed.Reset();
+
         InitialAttributesBackup = AttributeDataAsset->Attributes;
         Attributes = AttributeDataAsset->Attributes;
 
-        InitializeAttributeMap();
+        InitializeAttributeSlots();
 
-        for (const FAttribute& Attribute : Attributes)
+        for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
         {
+            const FAttribute& Attribute = Attributes[Slot];
             OnAttributeChanged.Broadcast(Attribute.AttributeTag, Attribute.Value);
-            CheckRegenStatus(Attribute.AttributeTag);
+            NotifyAttributeChange(Slot, Attribute.Value, Attribute.Value, EAttributeOperation::Override, EAttributeChangeSource::Initialize);
+            CheckRegenStatus(Slot);
             UE_LOG(LogTemp, Warning, TEXT("Loaded Attribute from DataAsset - Tag: %s, Value: %f, Min: %f, Max: %f"),
                 *Attribute.AttributeTag.ToString(), Attribute.Value, Attribute.MinValue, Attribute.MaxValue);
         }
@@ -36,6 +52,8 @@ void UAttributeComponent::LoadAttributesFromDataAsset()
         OnInitializeAttributes.Broadcast();
 
         UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::LoadAttributesFromDataAsset - Attributes loaded from DataAsset"));
+
+        MarkAttributesReady();
     }
     else
     {
@@ -43,28 +61,330 @@ void UAttributeComponent::LoadAttributesFromDataAsset()
     }
 }
 
-void UAttributeComponent::InitializeAttributeMap()
+void UAttributeComponent::InitializeAttributeSlots()
 {
-    AttributeMap.Empty();
-    for (FAttribute& Attribute : Attributes)
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    DEC_DWORD_STAT_BY(STAT_AttributeSystem_NumAttributes, AttributeIds.Num());
+
+    FAttributeRegistry& Registry = FAttributeRegistry::Get();
+    AttributeIds.Reset(Attributes.Num());
+    RegenTimers.SetNum(Attributes.Num());
+    RegenElapsed.SetNumZeroed(Attributes.Num());
+
+    int32 NumIds = 0;
+    for (const FAttribute& Attribute : Attributes)
     {
-        AttributeMap.Add(Attribute.AttributeTag, Attribute);
+        const FAttributeId AttributeId = Registry.Register(Attribute.AttributeTag);
+        AttributeIds.Add(AttributeId);
+        NumIds = AttributeId.IsValid() ? FMath::Max(NumIds, AttributeId.GetIndex() + 1) : NumIds;
+    }
+
+    SlotsById.Init(INDEX_NONE, NumIds);
+    for (int32 Slot = 0; Slot < AttributeIds.Num(); ++Slot)
+    {
+        if (AttributeIds[Slot].IsValid())
+        {
+            SlotsById[AttributeIds[Slot].GetIndex()] = Slot;
+        }
+    }
+
+    if (bDeterministic)
+    {
+        for (int32 Slot = DeterministicStates.Num(); Slot < Attributes.Num(); ++Slot)
+        {
+            DeterministicStates.AddDefaulted();
+            InitializeDeterministicState(Slot);
+        }
+    }
+
+    BuildGroupIndex();
+
+    INC_DWORD_STAT_BY(STAT_AttributeSystem_NumAttributes, AttributeIds.Num());
+    SyncQueryIndex();
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::InitializeAttributeSlots"));
+}
+
+void UAttributeComponent::BuildGroupIndex()
+{
+    GroupRanges.Reset();
+    GroupSlots.Reset();
+
+    TArray<TPair<FGameplayTag, int32>> Entries;
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
+    {
+        for (FGameplayTag Tag = Attributes[Slot].AttributeTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+        {
+            Entries.Emplace(Tag, Slot);
+        }
+    }
+
+    Entries.Sort([](const TPair<FGameplayTag, int32>& A, const TPair<FGameplayTag, int32>& B)
+        {
+            return A.Key == B.Key ? A.Value < B.Value : A.Key.GetTagName().FastLess(B.Key.GetTagName());
+        });
+
+    GroupSlots.Reserve(Entries.Num());
+    for (const TPair<FGameplayTag, int32>& Entry : Entries)
+    {
+        ++GroupRanges.FindOrAdd(Entry.Key, FAttributeGroupRange{ GroupSlots.Num(), 0 }).Num;
+        GroupSlots.Add(Entry.Value);
     }
-    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::InitializeAttributeMap"));
+}
+
+TConstArrayView<int32> UAttributeComponent::FindGroupSlots(const FGameplayTag& ParentTag) const
+{
+    const FAttributeGroupRange* Range = GroupRanges.Find(ParentTag);
+    return Range ? TConstArrayView<int32>(GroupSlots.GetData() + Range->Start, Range->Num) : TConstArrayView<int32>();
+}
+
+int32 UAttributeComponent::FindSlot(FAttributeId AttributeId) const
+{
+    return AttributeId.IsValid() && SlotsById.IsValidIndex(AttributeId.GetIndex()) ? SlotsById[AttributeId.GetIndex()] : INDEX_NONE;
 }
 
 
 void UAttributeComponent::BeginPlay()
 {
     Super::BeginPlay();
-    LoadAttributesFromDataAsset();
+    INC_DWORD_STAT(STAT_AttributeSystem_NumComponents);
+    if (bDeterministic)
+    {
+        // Lockstep peers simulate the same inputs, so attribute state is never sent over the network
+        SetIsReplicated(false);
+    }
+    if (UWorld* World = GetWorld())
+    {
+        QuerySubsystem = World->GetSubsystem<UAttributeQuerySubsystem>();
+
+        if (!bDeterministic && UAttributeUpdateSubsystem::IsEnabled())
+        {
+            UpdateSubsystem = World->GetSubsystem<UAttributeUpdateSubsystem>();
+            if (UpdateSubsystem)
+            {
+                UpdateSubsystem->RegisterComponent(this);
+            }
+        }
+
+        if (bPersistWhenStreamedOut && !bDeterministic)
+        {
+            DormantSubsystem = World->GetSubsystem<UAttributeDormantStateSubsystem>();
+        }
+    }
+    SyncQueryIndex();
+    RequestAttributeDataLoad();
     StartRegenTimer();
     UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::BeginPlay"));
 }
 
+void UAttributeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (AttributeDataLoadHandle.IsValid())
+    {
+        AttributeDataLoadHandle->CancelHandle();
+        AttributeDataLoadHandle.Reset();
+    }
+    bAttributesLoading = false;
+
+    if (DormantSubsystem)
+    {
+        // World Partition and level streaming remove actors from the world when their cell or level streams out
+        if (EndPlayReason == EEndPlayReason::RemovedFromWorld && bAttributesReady)
+        {
+            CaptureDormantState();
+        }
+        DormantSubsystem = nullptr;
+    }
+
+    if (QuerySubsystem)
+    {
+        QuerySubsystem->RemoveComponent(this);
+        QuerySubsystem = nullptr;
+    }
+
+    if (UpdateSubsystem)
+    {
+        UpdateSubsystem->UnregisterComponent(this);
+        UpdateSubsystem = nullptr;
+    }
+
+    StopAllRegen();
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearAllTimersForObject(this);
+    }
+    TimedModifiers.Reset();
+
+    DEC_DWORD_STAT(STAT_AttributeSystem_NumComponents);
+    DEC_DWORD_STAT_BY(STAT_AttributeSystem_NumAttributes, AttributeIds.Num());
+    DEC_DWORD_STAT_BY(STAT_AttributeSystem_NumActiveModifiers, ActiveModifiers.Num());
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UAttributeComponent::RequestAttributeDataLoad()
+{
+    if (AttributeDataAsset)
+    {
+        LoadAttributesFromDataAsset();
+        return;
+    }
+
+    if (SoftAttributeDataAsset.IsNull())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RequestAttributeDataLoad - No DataAsset assigned"));
+        MarkAttributesReady();
+        return;
+    }
+
+    if (UAttributeData* LoadedDataAsset = SoftAttributeDataAsset.Get())
+    {
+        // Already resident, e.g. preloaded through UAttributeDataPreloadSubsystem
+        AttributeDataAsset = LoadedDataAsset;
+        LoadAttributesFromDataAsset();
+        return;
+    }
+
+    if (bAttributesLoading)
+    {
+        return;
+    }
+
+    bAttributesLoading = true;
+    AttributeDataLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        SoftAttributeDataAsset.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &UAttributeComponent::OnAttributeDataLoaded));
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RequestAttributeDataLoad - Streaming DataAsset: %s"), *SoftAttributeDataAsset.ToString());
+}
+
+void UAttributeComponent::OnAttributeDataLoaded()
+{
+    AttributeDataLoadHandle.Reset();
+    AttributeDataAsset = SoftAttributeDataAsset.Get();
+
+    if (AttributeDataAsset)
+    {
+        LoadAttributesFromDataAsset();
+        StartRegenTimer();
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::OnAttributeDataLoaded - Failed to load DataAsset: %s"), *SoftAttributeDataAsset.ToString());
+        MarkAttributesReady();
+    }
+}
+
+void UAttributeComponent::MarkAttributesReady()
+{
+    bAttributesLoading = false;
+
+    if (bAttributesReady)
+    {
+        return;
+    }
+    bAttributesReady = true;
+
+    if (DormantSubsystem)
+    {
+        RestoreDormantState();
+    }
+
+    TArray<FPendingAttributeOperation> Operations = MoveTemp(PendingOperations);
+    for (const FPendingAttributeOperation& Operation : Operations)
+    {
+        ReplayPendingOperation(Operation);
+    }
+    PendingAttributes.Reset();
+    PendingLoadSlots.Reset();
+
+    OnAttributesReady.Broadcast();
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::MarkAttributesReady - Attributes ready, replayed %d operations"), Operations.Num());
+}
+
+void UAttributeComponent::QueuePendingOperation(EPendingOperationType Type, FAttributeId AttributeId, float Value, EAttributeOperation Operation, float Duration, const FGameplayTag& GroupTag)
+{
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    PendingOperations.Add({ Type, AttributeId, Value, Operation, Duration, GroupTag });
+}
+
+void UAttributeComponent::ReplayPendingOperation(const FPendingAttributeOperation& Operation)
+{
+    const FGameplayTag AttributeTag = Operation.AttributeId.GetTag();
+
+    switch (Operation.Type)
+    {
+    case EPendingOperationType::Value:
+        SetAttributeValueInternal(Operation.AttributeId, Operation.Value, Operation.Operation);
+        break;
+    case EPendingOperationType::GroupValue:
+        SetGroupAttributeValue(Operation.GroupTag, Operation.Value, Operation.Operation);
+        break;
+    case EPendingOperationType::MinValue:
+        SetAttributeMinValue(AttributeTag, Operation.Value, Operation.Operation);
+        break;
+    case EPendingOperationType::MaxValue:
+        SetAttributeMaxValue(AttributeTag, Operation.Value, Operation.Operation);
+        break;
+    case EPendingOperationType::UseRegen:
+        SetUseRegen(AttributeTag, Operation.Value != 0.0f);
+        break;
+    case EPendingOperationType::ApplyModifier:
+        ApplyModifier(FAttributeModifier(AttributeTag, Operation.Value, Operation.Duration));
+        break;
+    case EPendingOperationType::RemoveModifier:
+        RemoveModifier(AttributeTag, Operation.Value);
+        break;
+    case EPendingOperationType::AddAttribute:
+        if (PendingAttributes.Num() > 0)
+        {
+            const FAttribute NewAttribute = PendingAttributes[0];
+            PendingAttributes.RemoveAt(0, 1, EAllowShrinking::No);
+            AddAttribute(NewAttribute);
+        }
+        break;
+    case EPendingOperationType::RemoveAttribute:
+        RemoveAttribute(AttributeTag);
+        break;
+    case EPendingOperationType::ResetAll:
+        ResetAllAttributes();
+        break;
+    case EPendingOperationType::DeathCheck:
+        CheckDeath();
+        break;
+    case EPendingOperationType::LoadFromSlot:
+        if (PendingLoadSlots.Num() > 0)
+        {
+            const TPair<FString, int32> LoadSlot = PendingLoadSlots[0];
+            PendingLoadSlots.RemoveAt(0, 1, EAllowShrinking::No);
+            LoadAttributes(LoadSlot.Key, LoadSlot.Value);
+        }
+        break;
+    }
+}
+
+void UAttributeComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(InitialAttributesBackup.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Attributes.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(AttributeIds.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(SlotsById.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GroupRanges.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GroupSlots.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(RegenTimers.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ActiveModifiers.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(DeterministicStates.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(DeterministicModifiers.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(RegenElapsed.GetAllocatedSize());
+    CumulativeResourceSize.AddDedicatedSystemMemoryBytes(TimedModifiers.GetAllocatedSize());
+}
+
 float UAttributeComponent::GetAttributeValue(const FGameplayTag& AttributeTag) const
 {
-    if (const FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    if (const FAttribute* FoundAttribute = FindAttribute(AttributeTag))
     {
         UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::GetAttributeValue - Attribute: %s, Value: %f"), *AttributeTag.ToString(), FoundAttribute->Value);
         return FoundAttribute->Value;
@@ -73,28 +393,205 @@ float UAttributeComponent::GetAttributeValue(const FGameplayTag& AttributeTag) c
     return 0.0f;
 }
 
+FAttributeId UAttributeComponent::GetAttributeId(const FGameplayTag& AttributeTag)
+{
+    return FAttributeId::FromTag(AttributeTag);
+}
+
+float UAttributeComponent::GetAttributeValueById(FAttributeId AttributeId) const
+{
+    const FAttribute* FoundAttribute = FindAttribute(AttributeId);
+    return FoundAttribute ? FoundAttribute->Value : 0.0f;
+}
+
+void UAttributeComponent::SetAttributeValueById(FAttributeId AttributeId, float Value, EAttributeOperation Operation)
+{
+    SetAttributeValueInternal(AttributeId, Value, Operation);
+}
+
+const FAttribute* UAttributeComponent::FindAttribute(FAttributeId AttributeId) const
+{
+    const int32 Slot = FindSlot(AttributeId);
+    return Slot != INDEX_NONE ? &Attributes[Slot] : nullptr;
+}
+
+const FAttribute* UAttributeComponent::FindAttribute(const FGameplayTag& AttributeTag) const
+{
+    return FindAttribute(FAttributeId::FromTag(AttributeTag));
+}
+
 void UAttributeComponent::SetAttributeValue(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation)
 {
-    SetAttributeValueInternal(AttributeTag, Value, Operation);
+    SetAttributeValueInternal(ResolveAttributeId(AttributeTag), Value, Operation);
 }
 
 void UAttributeComponent::DecreaseAttributeValue(const FGameplayTag& AttributeTag, float Amount)
 {
-    SetAttributeValueInternal(AttributeTag, Amount, EAttributeOperation::Subtract);
+    SetAttributeValueInternal(ResolveAttributeId(AttributeTag), Amount, EAttributeOperation::Subtract);
 }
 
 void UAttributeComponent::IncreaseAttributeValue(const FGameplayTag& AttributeTag, float Amount)
 {
-    SetAttributeValueInternal(AttributeTag, Amount, EAttributeOperation::Add);
+    SetAttributeValueInternal(ResolveAttributeId(AttributeTag), Amount, EAttributeOperation::Add);
+}
+
+bool UAttributeComponent::ValidateCosts(const TArray<FAttributeCost>& Costs, FSlotCostArray& OutSlotCosts) const
+{
+    if (bAttributesLoading)
+    {
+        return false;
+    }
+
+    for (const FAttributeCost& Cost : Costs)
+    {
+        const int32 Slot = FindSlot(FAttributeId::FromTag(Cost.AttributeTag));
+        if (Slot == INDEX_NONE || Cost.Amount < 0.0f)
+        {
+            return false;
+        }
+
+        if (TPair<int32, float>* SlotCost = OutSlotCosts.FindByPredicate([Slot](const TPair<int32, float>& Entry) { return Entry.Key == Slot; }))
+        {
+            SlotCost->Value += Cost.Amount;
+        }
+        else
+        {
+            OutSlotCosts.Emplace(Slot, Cost.Amount);
+        }
+    }
+
+    for (const TPair<int32, float>& SlotCost : OutSlotCosts)
+    {
+        if (bDeterministic)
+        {
+            const FDeterministicAttributeState& State = DeterministicStates[SlotCost.Key];
+            if (State.Value - FAttributeFixed::FromFloat(SlotCost.Value) < State.MinValue)
+            {
+                return false;
+            }
+        }
+        else if (Attributes[SlotCost.Key].Value - SlotCost.Value < Attributes[SlotCost.Key].MinValue)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool UAttributeComponent::CanAfford(const TArray<FAttributeCost>& Costs) const
+{
+    FSlotCostArray SlotCosts;
+    return ValidateCosts(Costs, SlotCosts);
+}
+
+bool UAttributeComponent::TryConsume(const TArray<FAttributeCost>& Costs)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_TryConsume);
+
+    FSlotCostArray SlotCosts;
+    if (!ValidateCosts(Costs, SlotCosts))
+    {
+        return false;
+    }
+
+    if (OnPreAttributeChanged.IsBound())
+    {
+        TArray<TPair<FGameplayTag, float>, TInlineAllocator<8>> PreChanges;
+        for (const TPair<int32, float>& SlotCost : SlotCosts)
+        {
+            const FAttribute& Attribute = Attributes[SlotCost.Key];
+            PreChanges.Emplace(Attribute.AttributeTag, FMath::Max(Attribute.Value - SlotCost.Value, Attribute.MinValue));
+        }
+        for (const TPair<FGameplayTag, float>& PreChange : PreChanges)
+        {
+            OnPreAttributeChanged.Broadcast(PreChange.Key, PreChange.Value);
+        }
+
+        // Handlers may have changed the attributes, so the whole cost is checked again before anything is paid
+        SlotCosts.Reset();
+        if (!ValidateCosts(Costs, SlotCosts))
+        {
+            return false;
+        }
+    }
+
+    TArray<float, TInlineAllocator<8>> OldValues;
+    for (const TPair<int32, float>& SlotCost : SlotCosts)
+    {
+        FAttribute& Attribute = Attributes[SlotCost.Key];
+        OldValues.Add(Attribute.Value);
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[SlotCost.Key];
+            State.Value = State.Value - FAttributeFixed::FromFloat(SlotCost.Value);
+            Attribute.Value = State.Value.ToFloat();
+        }
+        else
+        {
+            Attribute.Value = FMath::Max(Attribute.Value - SlotCost.Value, Attribute.MinValue);
+        }
+    }
+
+    // Resolved by id again since a listener may add or remove attributes
+    TArray<FAttributeId, TInlineAllocator<8>> PaidIds;
+    for (const TPair<int32, float>& SlotCost : SlotCosts)
+    {
+        PaidIds.Add(AttributeIds[SlotCost.Key]);
+    }
+
+    for (int32 Index = 0; Index < PaidIds.Num(); ++Index)
+    {
+        const int32 Slot = FindSlot(PaidIds[Index]);
+        if (Slot != INDEX_NONE && Attributes[Slot].Value != OldValues[Index])
+        {
+            OnAttributeChanged.Broadcast(Attributes[Slot].AttributeTag, Attributes[Slot].Value);
+            NotifyAttributeChange(Slot, OldValues[Index], Attributes[Slot].Value, EAttributeOperation::Subtract, EAttributeChangeSource::Consume);
+            CheckRegenStatus(Slot);
+        }
+    }
+
+    // A health cost can take health down to its minimum, which must end the same way as DecreaseHealth
+    if (PaidIds.Contains(FAttributeId::FromTag(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")))))
+    {
+        CheckDeath();
+    }
+
+    return true;
 }
 
 void UAttributeComponent::SetAttributeMinValue(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation)
 {
-    if (FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_SetAttribute);
+
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::MinValue, ResolveAttributeId(AttributeTag), Value, Operation);
+        return;
+    }
+
+    const int32 Slot = FindSlot(FAttributeId::FromTag(AttributeTag));
+    if (Slot != INDEX_NONE)
     {
+        FAttribute* FoundAttribute = &Attributes[Slot];
         float OldValue = FoundAttribute->MinValue;
         float NewValue = OldValue;
 
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[Slot];
+            State.MinValue = FMath::Clamp(ApplyFixedOperation(State.MinValue, Value, Operation), FAttributeFixed(), State.MaxValue);
+            FoundAttribute->MinValue = State.MinValue.ToFloat();
+
+            if (OldValue != FoundAttribute->MinValue)
+            {
+                OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->MinValue);
+                NotifyAttributeChange(Slot, OldValue, FoundAttribute->MinValue, Operation, EAttributeChangeSource::MinValue);
+                CheckRegenStatus(Slot);
+            }
+            return;
+        }
+
         switch (Operation)
         {
         case EAttributeOperation::Add:
@@ -129,7 +626,8 @@ void UAttributeComponent::SetAttributeMinValue(const FGameplayTag& AttributeTag,
         if (OldValue != FoundAttribute->MinValue)
         {
             OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->MinValue);
-            CheckRegenStatus(AttributeTag);
+            NotifyAttributeChange(Slot, OldValue, FoundAttribute->MinValue, Operation, EAttributeChangeSource::MinValue);
+            CheckRegenStatus(Slot);
             UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeMinValue - Attribute: %s, Old Min Value: %f, New Min Value: %f, Operation: %d"), *AttributeTag.ToString(), OldValue, FoundAttribute->MinValue, (int32)Operation);
         }
     }
@@ -141,11 +639,36 @@ void UAttributeComponent::SetAttributeMinValue(const FGameplayTag& AttributeTag,
 
 void UAttributeComponent::SetAttributeMaxValue(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation)
 {
-    if (FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_SetAttribute);
+
+    if (bAttributesLoading)
     {
+        QueuePendingOperation(EPendingOperationType::MaxValue, ResolveAttributeId(AttributeTag), Value, Operation);
+        return;
+    }
+
+    const int32 Slot = FindSlot(FAttributeId::FromTag(AttributeTag));
+    if (Slot != INDEX_NONE)
+    {
+        FAttribute* FoundAttribute = &Attributes[Slot];
         float OldValue = FoundAttribute->MaxValue;
         float NewValue = OldValue;
 
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[Slot];
+            State.MaxValue = FMath::Max(ApplyFixedOperation(State.MaxValue, Value, Operation), State.MinValue);
+            FoundAttribute->MaxValue = State.MaxValue.ToFloat();
+
+            if (OldValue != FoundAttribute->MaxValue)
+            {
+                OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->MaxValue);
+                NotifyAttributeChange(Slot, OldValue, FoundAttribute->MaxValue, Operation, EAttributeChangeSource::MaxValue);
+                CheckRegenStatus(Slot);
+            }
+            return;
+        }
+
         switch (Operation)
         {
         case EAttributeOperation::Add:
@@ -180,7 +703,8 @@ void UAttributeComponent::SetAttributeMaxValue(const FGameplayTag& AttributeTag,
         if (OldValue != FoundAttribute->MaxValue)
         {
             OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->MaxValue);
-            CheckRegenStatus(AttributeTag);
+            NotifyAttributeChange(Slot, OldValue, FoundAttribute->MaxValue, Operation, EAttributeChangeSource::MaxValue);
+            CheckRegenStatus(Slot);
             UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeMaxValue - Attribute: %s, Old Max Value: %f, New Max Value: %f, Operation: %d"), *AttributeTag.ToString(), OldValue, FoundAttribute->MaxValue, (int32)Operation);
         }
     }
@@ -193,7 +717,7 @@ void UAttributeComponent::SetAttributeMaxValue(const FGameplayTag& AttributeTag,
 
 FAttribute UAttributeComponent::GetAttribute(const FGameplayTag& AttributeTag) const
 {
-    if (const FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    if (const FAttribute* FoundAttribute = FindAttribute(AttributeTag))
     {
         UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::GetAttribute - Attribute: %s, Value: %f"), *AttributeTag.ToString(), FoundAttribute->Value);
         return *FoundAttribute;
@@ -210,7 +734,7 @@ TArray<FAttribute> UAttributeComponent::GetAllAttributes() const
 
 void UAttributeComponent::GetAttributeValues(const FGameplayTag& AttributeTag, float& OutValue, float& OutMin, float& OutMax) const
 {
-    if (const FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    if (const FAttribute* FoundAttribute = FindAttribute(AttributeTag))
     {
         OutValue = FoundAttribute->Value;
         OutMin = FoundAttribute->MinValue;
@@ -228,7 +752,7 @@ void UAttributeComponent::GetAttributeValues(const FGameplayTag& AttributeTag, f
 
 float UAttributeComponent::GetAttributeNormalized(const FGameplayTag& AttributeTag) const
 {
-    if (const FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    if (const FAttribute* FoundAttribute = FindAttribute(AttributeTag))
     {
         if (FoundAttribute->MaxValue != FoundAttribute->MinValue)
         {
@@ -244,47 +768,139 @@ float UAttributeComponent::GetAttributeNormalized(const FGameplayTag& AttributeT
 TMap<FGameplayTag, FAttribute> UAttributeComponent::GetAttributeMap() const
 {
     UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::GetAttributeMap"));
+
+    TMap<FGameplayTag, FAttribute> AttributeMap;
+    AttributeMap.Reserve(Attributes.Num());
+    for (const FAttribute& Attribute : Attributes)
+    {
+        AttributeMap.Add(Attribute.AttributeTag, Attribute);
+    }
     return AttributeMap;
 }
 
-void UAttributeComponent::SetUseRegen(const FGameplayTag& AttributeTag, bool bUseRegen)
+void UAttributeComponent::ForEachAttributeInGroup(const FGameplayTag& ParentTag, TFunctionRef<void(const FAttribute&)> Visitor) const
 {
-    if (FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    for (const int32 Slot : FindGroupSlots(ParentTag))
     {
-        FoundAttribute->bUseRegen = bUseRegen;
-        CheckRegenStatus(AttributeTag);
-        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetUseRegen - Attribute: %s, UseRegen: %s"), *AttributeTag.ToString(), bUseRegen ? TEXT("true") : TEXT("false"));
+        Visitor(Attributes[Slot]);
     }
 }
 
-bool UAttributeComponent::IsValidAttribute(const FGameplayTag& AttributeTag) const
+int32 UAttributeComponent::GetAttributesInGroup(const FGameplayTag& ParentTag, TArray<FAttribute>& OutAttributes) const
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_GroupQuery);
+
+    const TConstArrayView<int32> Slots = FindGroupSlots(ParentTag);
+    OutAttributes.Reset(Slots.Num());
+    for (const int32 Slot : Slots)
+    {
+        OutAttributes.Add(Attributes[Slot]);
+    }
+    return Slots.Num();
+}
+
+int32 UAttributeComponent::GetNumAttributesInGroup(const FGameplayTag& ParentTag) const
 {
-    return AttributeMap.Contains(AttributeTag);
+    return FindGroupSlots(ParentTag).Num();
 }
 
-void UAttributeComponent::AddAttribute(const FAttribute& NewAttribute)
+void UAttributeComponent::SetGroupAttributeValue(const FGameplayTag& ParentTag, float Value, EAttributeOperation Operation)
 {
-    if (!IsValidAttribute(NewAttribute.AttributeTag))
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_GroupQuery);
+
+    if (bAttributesLoading)
     {
-        Attributes.Add(NewAttribute);
-        InitializeAttributeMap();
-        OnAttributeChanged.Broadcast(NewAttribute.AttributeTag, NewAttribute.Value);
-        OnAttributeAdded.Broadcast(NewAttribute.AttributeTag, NewAttribute.Value);
-        CheckRegenStatus(NewAttribute.AttributeTag);
-        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::AddAttribute - Attribute added: %s"), *NewAttribute.AttributeTag.ToString());
+        // The group is resolved against the loaded attributes when the queue is replayed
+        QueuePendingOperation(EPendingOperationType::GroupValue, FAttributeId(), Value, Operation, 0.0f, ParentTag);
+        return;
     }
-    else
+
+    // Copied by id since listeners of each change may add or remove attributes
+    TArray<FAttributeId, TInlineAllocator<16>> GroupIds;
+    for (const int32 Slot : FindGroupSlots(ParentTag))
     {
-        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::AddAttribute - Attribute already exists: %s"), *NewAttribute.AttributeTag.ToString());
+        GroupIds.Add(AttributeIds[Slot]);
     }
-}
 
-void UAttributeComponent::RemoveAttribute(const FGameplayTag& AttributeTag)
-{
-    if (IsValidAttribute(AttributeTag))
+    for (const FAttributeId AttributeId : GroupIds)
     {
-        Attributes.RemoveAll([&](const FAttribute& Attribute) { return Attribute.AttributeTag == AttributeTag; });
-        InitializeAttributeMap();
+        SetAttributeValueInternal(AttributeId, Value, Operation);
+    }
+}
+
+void UAttributeComponent::SetUseRegen(const FGameplayTag& AttributeTag, bool bUseRegen)
+{
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::UseRegen, ResolveAttributeId(AttributeTag), bUseRegen ? 1.0f : 0.0f);
+        return;
+    }
+
+    const int32 Slot = FindSlot(FAttributeId::FromTag(AttributeTag));
+    if (Slot != INDEX_NONE)
+    {
+        Attributes[Slot].bUseRegen = bUseRegen;
+        CheckRegenStatus(Slot);
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetUseRegen - Attribute: %s, UseRegen: %s"), *AttributeTag.ToString(), bUseRegen ? TEXT("true") : TEXT("false"));
+    }
+}
+
+bool UAttributeComponent::IsValidAttribute(const FGameplayTag& AttributeTag) const
+{
+    return FindAttribute(AttributeTag) != nullptr;
+}
+
+void UAttributeComponent::AddAttribute(const FAttribute& NewAttribute)
+{
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    if (bAttributesLoading)
+    {
+        PendingAttributes.Add(NewAttribute);
+        QueuePendingOperation(EPendingOperationType::AddAttribute, ResolveAttributeId(NewAttribute.AttributeTag));
+        return;
+    }
+
+    if (!IsValidAttribute(NewAttribute.AttributeTag))
+    {
+        Attributes.Add(NewAttribute);
+        InitializeAttributeSlots();
+        OnAttributeChanged.Broadcast(NewAttribute.AttributeTag, NewAttribute.Value);
+        OnAttributeAdded.Broadcast(NewAttribute.AttributeTag, NewAttribute.Value);
+        CheckRegenStatus(Attributes.Num() - 1);
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::AddAttribute - Attribute added: %s"), *NewAttribute.AttributeTag.ToString());
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::AddAttribute - Attribute already exists: %s"), *NewAttribute.AttributeTag.ToString());
+    }
+}
+
+void UAttributeComponent::RemoveAttribute(const FGameplayTag& AttributeTag)
+{
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::RemoveAttribute, ResolveAttributeId(AttributeTag));
+        return;
+    }
+
+    const int32 Slot = FindSlot(FAttributeId::FromTag(AttributeTag));
+    if (Slot != INDEX_NONE)
+    {
+        StopRegen(Slot);
+        if (QuerySubsystem)
+        {
+            QuerySubsystem->RemoveAttribute(this, AttributeIds[Slot]);
+        }
+
+        Attributes.RemoveAt(Slot);
+        RegenTimers.RemoveAt(Slot);
+        if (DeterministicStates.IsValidIndex(Slot))
+        {
+            DeterministicStates.RemoveAt(Slot);
+        }
+        RegenElapsed.RemoveAt(Slot);
+        InitializeAttributeSlots();
         OnAttributeChanged.Broadcast(AttributeTag, 0.0f);
         OnAttributeRemoved.Broadcast(AttributeTag);
         UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RemoveAttribute - Attribute removed: %s"), *AttributeTag.ToString());
@@ -297,7 +913,7 @@ void UAttributeComponent::RemoveAttribute(const FGameplayTag& AttributeTag)
 
 void UAttributeComponent::CheckThresholds(const FGameplayTag& AttributeTag)
 {
-    if (const FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    if (const FAttribute* FoundAttribute = FindAttribute(AttributeTag))
     {
         if (FoundAttribute->Value <= FoundAttribute->MinValue)
         {
@@ -309,56 +925,176 @@ void UAttributeComponent::CheckThresholds(const FGameplayTag& AttributeTag)
 
 void UAttributeComponent::ApplyModifier(const FAttributeModifier& Modifier)
 {
-    if (IsValidAttribute(Modifier.AttributeTag))
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_ApplyModifier);
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::ApplyModifier, ResolveAttributeId(Modifier.AttributeTag), Modifier.Value, EAttributeOperation::Add, Modifier.Duration);
+        return;
+    }
+
+    const FAttributeId AttributeId = FAttributeId::FromTag(Modifier.AttributeTag);
+    const int32 Slot = FindSlot(AttributeId);
+    if (Slot != INDEX_NONE)
     {
-        FAttribute* FoundAttribute = AttributeMap.Find(Modifier.AttributeTag);
-        if (FoundAttribute)
+        FAttribute* FoundAttribute = &Attributes[Slot];
+        const float OldValue = FoundAttribute->Value;
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[Slot];
+            State.Value = FMath::Clamp(State.Value + FAttributeFixed::FromFloat(Modifier.Value), State.MinValue, State.MaxValue);
+            FoundAttribute->Value = State.Value.ToFloat();
+        }
+        else
         {
             FoundAttribute->Value = FMath::Clamp(FoundAttribute->Value + Modifier.Value, FoundAttribute->MinValue, FoundAttribute->MaxValue);
-            ActiveModifiers.Add(Modifier);
-            OnAttributeChanged.Broadcast(Modifier.AttributeTag, FoundAttribute->Value);
-            UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ApplyModifier - Modifier applied to Attribute: %s, New Value: %f"), *Modifier.AttributeTag.ToString(), FoundAttribute->Value);
-
-            if (Modifier.Duration > 0.0f)
-            {
-                GetWorld()->GetTimerManager().SetTimerForNextTick([this, Modifier]()
-                    {
-                        FTimerHandle TimerHandle;
-                        GetWorld()->GetTimerManager().SetTimer(TimerHandle, [this, Modifier]()
-                            {
-                                RemoveModifier(Modifier.AttributeTag, Modifier.Value);
-                            }, Modifier.Duration, false);
-                    });
-            }
         }
+        FAttributeModifier& AppliedModifier = ActiveModifiers.Add_GetRef(Modifier);
+        AppliedModifier.AttributeId = AttributeId;
+        AppliedModifier.Handle = ++NextModifierHandle;
+        INC_DWORD_STAT(STAT_AttributeSystem_NumActiveModifiers);
+        OnAttributeChanged.Broadcast(Modifier.AttributeTag, FoundAttribute->Value);
+        NotifyAttributeChange(Slot, OldValue, FoundAttribute->Value, EAttributeOperation::Add, EAttributeChangeSource::Modifier);
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ApplyModifier - Modifier applied to Attribute: %s, New Value: %f"), *Modifier.AttributeTag.ToString(), FoundAttribute->Value);
+
+        if (Modifier.Duration > 0.0f)
+        {
+            ScheduleModifierExpiry(NextModifierHandle, AttributeId, Modifier.Value, Modifier.Duration);
+        }
+    }
+}
+
+void UAttributeComponent::ScheduleModifierExpiry(uint32 Handle, FAttributeId AttributeId, float ModifierValue, float Duration)
+{
+    if (bDeterministic)
+    {
+        DeterministicModifiers.Add({ Handle, AttributeId, ModifierValue, SimulationTick + SecondsToSimulationTicks(Duration) });
+        return;
     }
+
+    UWorld* World = GetWorld();
+    TimedModifiers.Add({ Handle, AttributeId, ModifierValue, World->GetTimeSeconds() + Duration });
+
+    if (UpdateSubsystem)
+    {
+        // Expired by the update phase
+        return;
+    }
+
+    FTimerHandle TimerHandle;
+    World->GetTimerManager().SetTimer(TimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, Handle]()
+        {
+            // Does nothing if the modifier was already removed through RemoveModifier
+            RemoveModifierByHandle(Handle);
+        }), Duration, false);
 }
 
 void UAttributeComponent::RemoveModifier(const FGameplayTag& AttributeTag, float ModifierValue)
 {
-    if (IsValidAttribute(AttributeTag))
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::RemoveModifier, ResolveAttributeId(AttributeTag), ModifierValue, EAttributeOperation::Subtract);
+        return;
+    }
+
+    RemoveModifierById(FAttributeId::FromTag(AttributeTag), ModifierValue);
+}
+
+void UAttributeComponent::RemoveModifierById(FAttributeId AttributeId, float ModifierValue)
+{
+    const FAttributeModifier* Modifier = ActiveModifiers.FindByPredicate([&](const FAttributeModifier& ActiveModifier)
+        {
+            return ActiveModifier.AttributeId == AttributeId && ActiveModifier.Value == ModifierValue;
+        });
+
+    if (!Modifier)
     {
-        FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag);
-        if (FoundAttribute)
+        UE_LOG(LogTemp, Verbose, TEXT("AttributeComponent::RemoveModifier - No active modifier of %f on Attribute: %s"), ModifierValue, *AttributeId.GetTag().ToString());
+        return;
+    }
+    RemoveModifierByHandle(Modifier->Handle);
+}
+
+void UAttributeComponent::RemoveModifierByHandle(uint32 Handle)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_RemoveModifier);
+
+    const int32 Index = ActiveModifiers.IndexOfByPredicate([Handle](const FAttributeModifier& Modifier) { return Modifier.Handle == Handle; });
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FAttributeId AttributeId = ActiveModifiers[Index].AttributeId;
+    const float ModifierValue = ActiveModifiers[Index].Value;
+    ActiveModifiers.RemoveAt(Index);
+    DEC_DWORD_STAT(STAT_AttributeSystem_NumActiveModifiers);
+
+    // Drop its pending expiry when removed explicitly; expiry paths have already taken their own entry out
+    TimedModifiers.RemoveAllSwap([Handle](const FTimedModifier& Modifier) { return Modifier.Handle == Handle; });
+    DeterministicModifiers.RemoveAll([Handle](const FDeterministicModifier& Modifier) { return Modifier.Handle == Handle; });
+
+    const int32 Slot = FindSlot(AttributeId);
+    if (Slot != INDEX_NONE)
+    {
+        FAttribute* FoundAttribute = &Attributes[Slot];
+        const FGameplayTag& AttributeTag = FoundAttribute->AttributeTag;
+        const float OldValue = FoundAttribute->Value;
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[Slot];
+            State.Value = FMath::Clamp(State.Value - FAttributeFixed::FromFloat(ModifierValue), State.MinValue, State.MaxValue);
+            FoundAttribute->Value = State.Value.ToFloat();
+        }
+        else
         {
             FoundAttribute->Value = FMath::Clamp(FoundAttribute->Value - ModifierValue, FoundAttribute->MinValue, FoundAttribute->MaxValue);
-            ActiveModifiers.RemoveAll([&](const FAttributeModifier& Modifier) { return Modifier.AttributeTag == AttributeTag && Modifier.Value == ModifierValue; });
-            OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->Value);
-            UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RemoveModifier - Modifier removed from Attribute: %s, New Value: %f"), *AttributeTag.ToString(), FoundAttribute->Value);
         }
+        OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->Value);
+        NotifyAttributeChange(Slot, OldValue, FoundAttribute->Value, EAttributeOperation::Subtract, EAttributeChangeSource::ModifierRemoved);
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RemoveModifier - Modifier removed from Attribute: %s, New Value: %f"), *AttributeTag.ToString(), FoundAttribute->Value);
     }
 }
 
 void UAttributeComponent::DecreaseHealth(float Amount)
 {
     SetAttributeValue(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")), Amount, EAttributeOperation::Subtract);
-    float CachedHealth = GetAttributeValue(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")));
+    if (bAttributesLoading)
+    {
+        // There is no current health to test against yet; checked right after the queued subtract is replayed
+        QueuePendingOperation(EPendingOperationType::DeathCheck, FAttributeId());
+        return;
+    }
+    CheckDeath();
+}
+
+void UAttributeComponent::CheckDeath()
+{
+    const FAttribute* HealthAttribute = FindAttribute(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")));
+    float CachedHealth = HealthAttribute ? HealthAttribute->Value : 0.0f;
     if (CachedHealth <= 0.f)
     {
         OnDeath.Broadcast();
     }
 }
 
+void UAttributeComponent::ApplyEffectDelta(FAttributeId AttributeId, float Delta, bool bCheckDeath)
+{
+    SetAttributeValueInternal(AttributeId, Delta, EAttributeOperation::Add, false);
+    if (!bCheckDeath)
+    {
+        return;
+    }
+
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::DeathCheck, FAttributeId());
+        return;
+    }
+    CheckDeath();
+}
+
 void UAttributeComponent::IncreaseHealth(float Amount)
 {
     SetAttributeValue(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")), Amount, EAttributeOperation::Add);
@@ -367,53 +1103,126 @@ void UAttributeComponent::IncreaseHealth(float Amount)
 
 void UAttributeComponent::ResetAllAttributes()
 {
-    for (auto& Elem : RegenTimers)
+    if (bAttributesLoading)
     {
-        GetWorld()->GetTimerManager().ClearTimer(Elem.Value);
+        QueuePendingOperation(EPendingOperationType::ResetAll, FAttributeId());
+        return;
     }
-    RegenTimers.Empty();
+
+    StopAllRegen();
+    DeterministicStates.Reset();
+    RegenElapsed.Reset();
 
     Attributes = InitialAttributesBackup;
 
-    InitializeAttributeMap();
+    InitializeAttributeSlots();
 
-    for (const FAttribute& Attribute : Attributes)
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
     {
+        const FAttribute& Attribute = Attributes[Slot];
         OnAttributeChanged.Broadcast(Attribute.AttributeTag, Attribute.Value);
-        CheckRegenStatus(Attribute.AttributeTag);
+        NotifyAttributeChange(Slot, Attribute.Value, Attribute.Value, EAttributeOperation::Override, EAttributeChangeSource::Reset);
+        CheckRegenStatus(Slot);
         UE_LOG(LogTemp, Warning, TEXT("Reset Attribute - Tag: %s, Value: %f, Min: %f, Max: %f"),
             *Attribute.AttributeTag.ToString(), Attribute.Value, Attribute.MinValue, Attribute.MaxValue);
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ResetAllAttributes - All attributes reset and AttributeMap reinitialized"));
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ResetAllAttributes - All attributes reset and attribute slots reinitialized"));
 }
 
 void UAttributeComponent::StartRegenTimer()
 {
-    for (FAttribute& Attribute : Attributes)
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
     {
+        const FAttribute& Attribute = Attributes[Slot];
         if (Attribute.bUseRegen && Attribute.Value < Attribute.MaxValue)
         {
-            FTimerHandle& TimerHandle = RegenTimers.FindOrAdd(Attribute.AttributeTag);
-            if (!GetWorld()->GetTimerManager().IsTimerActive(TimerHandle))
+            StartRegen(Slot);
+        }
+    }
+}
+
+void UAttributeComponent::StartRegen(int32 Slot)
+{
+    if (bDeterministic)
+    {
+        FDeterministicAttributeState& State = DeterministicStates[Slot];
+        if (State.NextRegenTick == INDEX_NONE && State.RegenPeriodTicks != INDEX_NONE)
+        {
+            State.NextRegenTick = SimulationTick + State.RegenPeriodTicks;
+        }
+        return;
+    }
+
+    if (UpdateSubsystem)
+    {
+        // Picked up by the next update phase
+        return;
+    }
+
+    FTimerHandle& TimerHandle = RegenTimers[Slot];
+    if (TimerHandle.IsValid() && GetWorld()->GetTimerManager().IsTimerActive(TimerHandle))
+    {
+        return;
+    }
+
+    if (!TimerHandle.IsValid())
+    {
+        INC_DWORD_STAT(STAT_AttributeSystem_NumRegenEntries);
+    }
+    GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UAttributeComponent::RegenerateAttributes, Attributes[Slot].RegenRate, true);
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::StartRegen - Regen started for Attribute: %s"), *Attributes[Slot].AttributeTag.ToString());
+}
+
+void UAttributeComponent::StopRegen(int32 Slot)
+{
+    if (bDeterministic)
+    {
+        DeterministicStates[Slot].NextRegenTick = INDEX_NONE;
+        return;
+    }
+
+    FTimerHandle& TimerHandle = RegenTimers[Slot];
+    if (TimerHandle.IsValid())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
+        DEC_DWORD_STAT(STAT_AttributeSystem_NumRegenEntries);
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::StopRegen - Regen stopped for Attribute: %s"), *Attributes[Slot].AttributeTag.ToString());
+    }
+}
+
+void UAttributeComponent::StopAllRegen()
+{
+    UWorld* World = GetWorld();
+    for (FTimerHandle& TimerHandle : RegenTimers)
+    {
+        if (TimerHandle.IsValid())
+        {
+            if (World)
             {
-                GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UAttributeComponent::RegenerateAttributes, Attribute.RegenRate, true);
-                UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::StartRegenTimer - Regen started for Attribute: %s"), *Attribute.AttributeTag.ToString());
+                World->GetTimerManager().ClearTimer(TimerHandle);
             }
+            TimerHandle.Invalidate();
+            DEC_DWORD_STAT(STAT_AttributeSystem_NumRegenEntries);
         }
     }
 }
 
 void UAttributeComponent::RegenerateAttributes()
 {
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Regen);
+
     UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RegenerateAttributes - Timer triggered"));
 
-    for (auto& Elem : RegenTimers)
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
     {
-        FGameplayTag AttributeTag = Elem.Key;
-        FAttribute* Attribute = AttributeMap.Find(AttributeTag);
+        if (!RegenTimers[Slot].IsValid())
+        {
+            continue;
+        }
 
-        if (Attribute && Attribute->bUseRegen)
+        FAttribute* Attribute = &Attributes[Slot];
+        if (Attribute->bUseRegen)
         {
             float OldValue = Attribute->Value;
             float NewValue = FMath::Clamp(OldValue + Attribute->RegenValue, Attribute->MinValue, Attribute->MaxValue);
@@ -424,16 +1233,12 @@ void UAttributeComponent::RegenerateAttributes()
             {
                 Attribute->Value = NewValue;
                 OnAttributeChanged.Broadcast(Attribute->AttributeTag, Attribute->Value);
+                NotifyAttributeChange(Slot, OldValue, NewValue, EAttributeOperation::Add, EAttributeChangeSource::Regen);
                 UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RegenerateAttributes - Attribute: %s, Old Value: %f, New Value: %f"), *Attribute->AttributeTag.ToString(), OldValue, Attribute->Value);
 
                 if (Attribute->Value >= Attribute->MaxValue)
                 {
-                    FTimerHandle* TimerHandle = RegenTimers.Find(AttributeTag);
-                    if (TimerHandle)
-                    {
-                        GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-                        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RegenerateAttributes - Regen stopped for Attribute: %s"), *AttributeTag.ToString());
-                    }
+                    StopRegen(Slot);
                 }
             }
             else
@@ -466,13 +1271,48 @@ float UAttributeComponent::GetHealthNormalized() const
     return GetAttributeNormalized(FGameplayTag::RequestGameplayTag(FName("Attribute.Health")));
 }
 
-void UAttributeComponent::SetAttributeValueInternal(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation)
+FAttributeId UAttributeComponent::ResolveAttributeId(const FGameplayTag& AttributeTag) const
+{
+    return bAttributesLoading ? FAttributeRegistry::Get().Register(AttributeTag) : FAttributeId::FromTag(AttributeTag);
+}
+
+void UAttributeComponent::SetAttributeValueInternal(FAttributeId AttributeId, float Value, EAttributeOperation Operation, bool bLogChange)
 {
-    if (FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_SetAttribute);
+
+    if (bAttributesLoading)
+    {
+        QueuePendingOperation(EPendingOperationType::Value, AttributeId, Value, Operation);
+        return;
+    }
+
+    const int32 Slot = FindSlot(AttributeId);
+    if (Slot != INDEX_NONE)
     {
+        FAttribute* FoundAttribute = &Attributes[Slot];
+        const FGameplayTag& AttributeTag = FoundAttribute->AttributeTag;
         float OldValue = FoundAttribute->Value;
         float NewValue = OldValue;
 
+        if (bDeterministic)
+        {
+            FDeterministicAttributeState& State = DeterministicStates[Slot];
+            const FAttributeFixed NewFixed = ApplyFixedOperation(State.Value, Value, Operation);
+
+            OnPreAttributeChanged.Broadcast(AttributeTag, NewFixed.ToFloat());
+
+            State.Value = FMath::Clamp(NewFixed, State.MinValue, State.MaxValue);
+            FoundAttribute->Value = State.Value.ToFloat();
+
+            if (OldValue != FoundAttribute->Value)
+            {
+                OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->Value);
+                NotifyAttributeChange(Slot, OldValue, FoundAttribute->Value, Operation, EAttributeChangeSource::Set);
+                CheckRegenStatus(Slot);
+            }
+            return;
+        }
+
         switch (Operation)
         {
         case EAttributeOperation::Add:
@@ -509,57 +1349,456 @@ void UAttributeComponent::SetAttributeValueInternal(const FGameplayTag& Attribut
         if (OldValue != FoundAttribute->Value)
         {
             OnAttributeChanged.Broadcast(AttributeTag, FoundAttribute->Value);
-            CheckRegenStatus(AttributeTag);
-            UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeValue - Attribute: %s, Old Value: %f, New Value: %f, Operation: %d"), *AttributeTag.ToString(), OldValue, FoundAttribute->Value, (int32)Operation);
+            NotifyAttributeChange(Slot, OldValue, FoundAttribute->Value, Operation, EAttributeChangeSource::Set);
+            CheckRegenStatus(Slot);
+            if (bLogChange)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeValue - Attribute: %s, Old Value: %f, New Value: %f, Operation: %d"), *AttributeTag.ToString(), OldValue, FoundAttribute->Value, (int32)Operation);
+            }
         }
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeValue - Attribute not found: %s"), *AttributeTag.ToString());
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SetAttributeValue - Attribute not found: %s"), *AttributeId.GetTag().ToString());
+    }
+}
+
+void UAttributeComponent::NotifyAttributeChange(int32 Slot, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source)
+{
+    if (QuerySubsystem)
+    {
+        QuerySubsystem->UpdateAttribute(this, AttributeIds[Slot], ComputeNormalized(Attributes[Slot]));
     }
+
+    RecordAttributeChange(Slot, OldValue, NewValue, Operation, Source);
 }
 
-void UAttributeComponent::CheckRegenStatus(const FGameplayTag& AttributeTag)
+void UAttributeComponent::RecordAttributeChange(int32 Slot, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source)
 {
-    if (FAttribute* FoundAttribute = AttributeMap.Find(AttributeTag))
+    AttributeSystemTrace::OutputAttributeChanged(this, Attributes[Slot].AttributeTag, OldValue, NewValue, Source);
+
+    if (!FAttributeTelemetryRecorder::IsRecording())
+    {
+        return;
+    }
+
+    FAttributeTelemetryRecorder& Recorder = FAttributeTelemetryRecorder::Get();
+    if (TelemetryActorId == 0)
     {
-        if (FoundAttribute->bUseRegen)
+        const AActor* Owner = GetOwner();
+        TelemetryActorId = Recorder.RegisterActor(Owner ? Owner->GetName() : GetName());
+    }
+
+    Recorder.Record(TelemetryActorId, AttributeIds[Slot], OldValue, NewValue, Operation, Source);
+}
+
+void UAttributeComponent::SyncQueryIndex()
+{
+    if (!QuerySubsystem)
+    {
+        return;
+    }
+
+    QuerySubsystem->RemoveComponent(this);
+    for (int32 Slot = 0; Slot < AttributeIds.Num(); ++Slot)
+    {
+        QuerySubsystem->UpdateAttribute(this, AttributeIds[Slot], ComputeNormalized(Attributes[Slot]));
+    }
+}
+
+float UAttributeComponent::ComputeNormalized(const FAttribute& Attribute)
+{
+    return Attribute.MaxValue != Attribute.MinValue ? (Attribute.Value - Attribute.MinValue) / (Attribute.MaxValue - Attribute.MinValue) : 0.0f;
+}
+
+void UAttributeComponent::CheckRegenStatus(int32 Slot)
+{
+    if (Attributes.IsValidIndex(Slot))
+    {
+        const FAttribute& FoundAttribute = Attributes[Slot];
+        if (FoundAttribute.bUseRegen)
         {
-            if (FoundAttribute->Value < FoundAttribute->MaxValue)
+            if (FoundAttribute.Value < FoundAttribute.MaxValue)
             {
-                FTimerHandle& TimerHandle = RegenTimers.FindOrAdd(AttributeTag);
-                if (!GetWorld()->GetTimerManager().IsTimerActive(TimerHandle))
-                {
-                    GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UAttributeComponent::RegenerateAttributes, FoundAttribute->RegenRate, true);
-                    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::CheckRegenStatus - Regen started for Attribute: %s"), *AttributeTag.ToString());
-                }
+                StartRegen(Slot);
             }
             else
             {
-                if (FTimerHandle* TimerHandle = RegenTimers.Find(AttributeTag))
-                {
-                    GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-                    RegenTimers.Remove(AttributeTag);
-                    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::CheckRegenStatus - Regen stopped for Attribute: %s"), *AttributeTag.ToString());
-                }
+                StopRegen(Slot);
             }
         }
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::CheckRegenStatus - Attribute not found: %s"), *AttributeTag.ToString());
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::CheckRegenStatus - Attribute slot not found: %d"), Slot);
+    }
+}
+
+void UAttributeComponent::InitializeDeterministicState(int32 Slot)
+{
+    FAttribute& Attribute = Attributes[Slot];
+    FDeterministicAttributeState& State = DeterministicStates[Slot];
+
+    State.Value = FAttributeFixed::FromFloat(Attribute.Value);
+    State.MinValue = FAttributeFixed::FromFloat(Attribute.MinValue);
+    State.MaxValue = FAttributeFixed::FromFloat(Attribute.MaxValue);
+    State.RegenValue = FAttributeFixed::FromFloat(Attribute.RegenValue);
+    State.RegenPeriodTicks = Attribute.RegenRate > 0.0f ? SecondsToSimulationTicks(Attribute.RegenRate) : INDEX_NONE;
+    State.NextRegenTick = INDEX_NONE;
+
+    // Keep the float mirror bit-identical to what the fixed-point state converts back to
+    Attribute.Value = State.Value.ToFloat();
+    Attribute.MinValue = State.MinValue.ToFloat();
+    Attribute.MaxValue = State.MaxValue.ToFloat();
+}
+
+int32 UAttributeComponent::SecondsToSimulationTicks(float Seconds) const
+{
+    return FMath::Max(1, FMath::RoundToInt(Seconds * FMath::Max(SimulationTickRate, 1)));
+}
+
+FAttributeFixed UAttributeComponent::ApplyFixedOperation(FAttributeFixed Current, float Operand, EAttributeOperation Operation)
+{
+    const FAttributeFixed FixedOperand = FAttributeFixed::FromFloat(Operand);
+
+    switch (Operation)
+    {
+    case EAttributeOperation::Add:
+        return Current + FixedOperand;
+    case EAttributeOperation::Subtract:
+        return Current - FixedOperand;
+    case EAttributeOperation::Multiply:
+        return Current * FixedOperand;
+    case EAttributeOperation::Divide:
+        if (FixedOperand.Raw != 0)
+        {
+            return Current / FixedOperand;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ApplyFixedOperation - Divide by zero"));
+        return Current;
+    case EAttributeOperation::Override:
+        return FixedOperand;
+    default:
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::ApplyFixedOperation - Invalid operation: %d"), (int32)Operation);
+        return Current;
+    }
+}
+
+void UAttributeComponent::AdvanceSimulationTick()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_SimulationTick);
+
+    if (!bDeterministic)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::AdvanceSimulationTick - Component is not deterministic"));
+        return;
+    }
+
+    ++SimulationTick;
+
+    // Expire modifiers in the order they were applied
+    for (int32 Index = 0; Index < DeterministicModifiers.Num();)
+    {
+        if (DeterministicModifiers[Index].ExpireTick <= SimulationTick)
+        {
+            const uint32 Handle = DeterministicModifiers[Index].Handle;
+            DeterministicModifiers.RemoveAt(Index);
+            RemoveModifierByHandle(Handle);
+        }
+        else
+        {
+            ++Index;
+        }
+    }
+
+    for (int32 Slot = 0; Slot < DeterministicStates.Num(); ++Slot)
+    {
+        FDeterministicAttributeState& State = DeterministicStates[Slot];
+        if (State.RegenPeriodTicks == INDEX_NONE || State.NextRegenTick == INDEX_NONE || State.NextRegenTick > SimulationTick)
+        {
+            continue;
+        }
+
+        FAttribute& Attribute = Attributes[Slot];
+        if (!Attribute.bUseRegen)
+        {
+            State.NextRegenTick = INDEX_NONE;
+            continue;
+        }
+
+        const float OldValue = Attribute.Value;
+        State.Value = FMath::Clamp(State.Value + State.RegenValue, State.MinValue, State.MaxValue);
+        State.NextRegenTick = State.Value < State.MaxValue ? SimulationTick + State.RegenPeriodTicks : INDEX_NONE;
+        Attribute.Value = State.Value.ToFloat();
+
+        if (OldValue != Attribute.Value)
+        {
+            OnAttributeChanged.Broadcast(Attribute.AttributeTag, Attribute.Value);
+            NotifyAttributeChange(Slot, OldValue, Attribute.Value, EAttributeOperation::Add, EAttributeChangeSource::Regen);
+        }
+    }
+
+    StateChecksum = ComputeStateChecksum();
+}
+
+uint32 UAttributeComponent::ComputeStateChecksum() const
+{
+    uint32 Checksum = FCrc::MemCrc32(&SimulationTick, sizeof(SimulationTick));
+
+    // Hashed by slot, i.e. data asset order, so peers whose attribute tags differ still agree while their data assets match
+    for (int32 Slot = 0; Slot < DeterministicStates.Num(); ++Slot)
+    {
+        const FDeterministicAttributeState& State = DeterministicStates[Slot];
+        const int64 Values[] = { Slot, State.Value.Raw, State.MinValue.Raw, State.MaxValue.Raw, State.NextRegenTick };
+        Checksum = FCrc::MemCrc32(Values, sizeof(Values), Checksum);
+    }
+
+    for (const FDeterministicModifier& Modifier : DeterministicModifiers)
+    {
+        const int64 Values[] = { FindSlot(Modifier.AttributeId), FAttributeFixed::FromFloat(Modifier.Value).Raw, Modifier.ExpireTick };
+        Checksum = FCrc::MemCrc32(Values, sizeof(Values), Checksum);
+    }
+
+    return Checksum;
+}
+
+void UAttributeComponent::UpdateAttributesParallel(float DeltaTime, double CurrentTime, TArray<FAttributeUpdateEvent>& OutEvents)
+{
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
+    {
+        FAttribute& Attribute = Attributes[Slot];
+        if (!Attribute.bUseRegen || Attribute.Value >= Attribute.MaxValue || Attribute.RegenRate <= 0.0f)
+        {
+            RegenElapsed[Slot] = 0.0f;
+            continue;
+        }
+
+        RegenElapsed[Slot] += DeltaTime;
+        if (RegenElapsed[Slot] < Attribute.RegenRate)
+        {
+            continue;
+        }
+
+        const int32 NumRegenTicks = FMath::FloorToInt32(RegenElapsed[Slot] / Attribute.RegenRate);
+        RegenElapsed[Slot] -= NumRegenTicks * Attribute.RegenRate;
+
+        const float OldValue = Attribute.Value;
+        Attribute.Value = FMath::Clamp(OldValue + Attribute.RegenValue * NumRegenTicks, Attribute.MinValue, Attribute.MaxValue);
+
+        if (OldValue != Attribute.Value)
+        {
+            // Trace and telemetry records are thread-safe, so only the query index and delegates are left to the game thread
+            RecordAttributeChange(Slot, OldValue, Attribute.Value, EAttributeOperation::Add, EAttributeChangeSource::Regen);
+            OutEvents.Add({ this, AttributeIds[Slot], EAttributeUpdateEvent::Regen, OldValue, Attribute.Value });
+            if (OldValue > Attribute.MinValue && Attribute.Value <= Attribute.MinValue)
+            {
+                OutEvents.Add({ this, AttributeIds[Slot], EAttributeUpdateEvent::ThresholdReached, OldValue, Attribute.Value });
+            }
+        }
+    }
+
+    for (int32 Index = TimedModifiers.Num() - 1; Index >= 0; --Index)
+    {
+        const FTimedModifier& Modifier = TimedModifiers[Index];
+        if (Modifier.ExpireTime <= CurrentTime)
+        {
+            OutEvents.Add({ this, Modifier.AttributeId, EAttributeUpdateEvent::ModifierExpired, 0.0f, Modifier.Value, Modifier.Handle });
+            TimedModifiers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
     }
 }
 
+void UAttributeComponent::DispatchUpdateEvent(const FAttributeUpdateEvent& Event)
+{
+    if (Event.Type == EAttributeUpdateEvent::ModifierExpired)
+    {
+        // Also drops the modifier if its attribute was removed in the meantime
+        RemoveModifierByHandle(Event.ModifierHandle);
+        return;
+    }
+
+    const int32 Slot = FindSlot(Event.AttributeId);
+    if (Slot == INDEX_NONE)
+    {
+        return;
+    }
+
+    switch (Event.Type)
+    {
+    case EAttributeUpdateEvent::Regen:
+        // Handlers of earlier events may have changed the attribute since the update, so the index gets its current state
+        OnAttributeChanged.Broadcast(Attributes[Slot].AttributeTag, Attributes[Slot].Value);
+        if (QuerySubsystem)
+        {
+            QuerySubsystem->UpdateAttribute(this, Event.AttributeId, ComputeNormalized(Attributes[Slot]));
+        }
+        break;
+    case EAttributeUpdateEvent::ThresholdReached:
+        OnAttributeThresholdReached.Broadcast(Attributes[Slot].AttributeTag, Event.NewValue);
+        break;
+    default:
+        break;
+    }
+}
+
+FName UAttributeComponent::GetDormantStateId() const
+{
+    if (!DormantStateId.IsNone())
+    {
+        return DormantStateId;
+    }
+
+    // Actors loaded with their level or World Partition cell keep their path across streaming, spawned actors do not
+    const AActor* Owner = GetOwner();
+    return Owner && Owner->HasAnyFlags(RF_WasLoaded) ? FName(*Owner->GetPathName()) : NAME_None;
+}
+
+void UAttributeComponent::CaptureDormantState()
+{
+    const FName StateId = GetDormantStateId();
+    if (StateId.IsNone())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::CaptureDormantState - No stable id for %s, state not kept"), *GetNameSafe(GetOwner()));
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    FAttributeDormantState State;
+    State.Values.Reserve(Attributes.Num());
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
+    {
+        const FAttribute& Attribute = Attributes[Slot];
+        State.Values.Add({ AttributeIds[Slot], Attribute.bUseRegen, Attribute.Value, Attribute.MinValue, Attribute.MaxValue });
+    }
+
+    // Modifiers with a duration are taken from TimedModifiers, which knows when they expire
+    const double CurrentTime = GetWorld()->GetTimeSeconds();
+    for (const FAttributeModifier& Modifier : ActiveModifiers)
+    {
+        if (Modifier.Duration <= 0.0f)
+        {
+            State.Modifiers.Add({ Modifier.AttributeId, Modifier.Value, -1.0f });
+        }
+    }
+    for (const FTimedModifier& Modifier : TimedModifiers)
+    {
+        State.Modifiers.Add({ Modifier.AttributeId, Modifier.Value, static_cast<float>(FMath::Max(Modifier.ExpireTime - CurrentTime, 0.0)) });
+    }
+
+    DormantSubsystem->StoreState(StateId, MoveTemp(State));
+}
+
+void UAttributeComponent::RestoreDormantState()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_DormantRestore);
+
+    const FName StateId = GetDormantStateId();
+    FAttributeDormantState State;
+    double Elapsed = 0.0;
+    if (StateId.IsNone() || !DormantSubsystem->TakeState(StateId, State, Elapsed))
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    TArray<float> OldValues;
+    OldValues.Reserve(Attributes.Num());
+    for (const FAttribute& Attribute : Attributes)
+    {
+        OldValues.Add(Attribute.Value);
+    }
+
+    for (const FDormantAttributeValue& Value : State.Values)
+    {
+        const int32 Slot = FindSlot(Value.AttributeId);
+        if (Slot != INDEX_NONE)
+        {
+            FAttribute& Attribute = Attributes[Slot];
+            Attribute.bUseRegen = Value.bUseRegen;
+            Attribute.MinValue = Value.MinValue;
+            Attribute.MaxValue = Value.MaxValue;
+            Attribute.Value = Value.Value;
+        }
+    }
+
+    for (const FDormantAttributeModifier& Modifier : State.Modifiers)
+    {
+        const int32 Slot = FindSlot(Modifier.AttributeId);
+        if (Slot == INDEX_NONE)
+        {
+            continue;
+        }
+
+        FAttribute& Attribute = Attributes[Slot];
+        if (Modifier.RemainingTime >= 0.0f && Modifier.RemainingTime <= Elapsed)
+        {
+            // Expired while dormant
+            Attribute.Value = FMath::Clamp(Attribute.Value - Modifier.Value, Attribute.MinValue, Attribute.MaxValue);
+            continue;
+        }
+
+        const float Duration = Modifier.RemainingTime >= 0.0f ? static_cast<float>(Modifier.RemainingTime - Elapsed) : -1.0f;
+        FAttributeModifier& RestoredModifier = ActiveModifiers.Add_GetRef(FAttributeModifier(Attribute.AttributeTag, Modifier.Value, Duration));
+        RestoredModifier.AttributeId = Modifier.AttributeId;
+        RestoredModifier.Handle = ++NextModifierHandle;
+        INC_DWORD_STAT(STAT_AttributeSystem_NumActiveModifiers);
+        if (Duration > 0.0f)
+        {
+            ScheduleModifierExpiry(RestoredModifier.Handle, Modifier.AttributeId, Modifier.Value, Duration);
+        }
+    }
+
+    for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
+    {
+        FAttribute& Attribute = Attributes[Slot];
+
+        // Every regen tick that would have fired while dormant, applied at once
+        if (Attribute.bUseRegen && Attribute.RegenRate > 0.0f && Attribute.Value < Attribute.MaxValue)
+        {
+            const int64 NumRegenTicks = FMath::FloorToInt64(Elapsed / Attribute.RegenRate);
+            Attribute.Value = FMath::Clamp(Attribute.Value + Attribute.RegenValue * static_cast<float>(NumRegenTicks), Attribute.MinValue, Attribute.MaxValue);
+        }
+
+        if (Attribute.Value != OldValues[Slot])
+        {
+            OnAttributeChanged.Broadcast(Attribute.AttributeTag, Attribute.Value);
+            NotifyAttributeChange(Slot, OldValues[Slot], Attribute.Value, EAttributeOperation::Override, EAttributeChangeSource::RestoreDormant);
+        }
+        CheckRegenStatus(Slot);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::RestoreDormantState - Restored %s after %.2f seconds dormant"), *StateId.ToString(), Elapsed);
+}
+
 void UAttributeComponent::SaveAttributes(FString SlotName, int32 Index)
 {
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Save);
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    if (bAttributesLoading)
+    {
+        // Nothing to save yet, writing now would replace the slot with the defaults
+        UE_LOG(LogTemp, Warning, TEXT("AttributeComponent::SaveAttributes - Attributes still loading, not saving to slot %s"), *SlotName);
+        return;
+    }
+
     UAttributeSaveGame* SaveGameInstance = Cast<UAttributeSaveGame>(UGameplayStatics::CreateSaveGameObject(UAttributeSaveGame::StaticClass()));
 
     if (SaveGameInstance)
     {
-        for (const auto& AttributePair : AttributeMap)
+        SaveGameInstance->SavedIds.Reserve(Attributes.Num());
+        SaveGameInstance->SavedTags.Reserve(Attributes.Num());
+        SaveGameInstance->SavedValues.Reserve(Attributes.Num());
+        for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
         {
-            SaveGameInstance->SavedAttributes.Add(AttributePair.Key, AttributePair.Value.Value);
+            if (AttributeIds[Slot].IsValid())
+            {
+                SaveGameInstance->SavedIds.Add(AttributeIds[Slot].GetIndex());
+                SaveGameInstance->SavedTags.Add(Attributes[Slot].AttributeTag);
+                SaveGameInstance->SavedValues.Add(Attributes[Slot].Value);
+            }
         }
 
         if (UGameplayStatics::SaveGameToSlot(SaveGameInstance, SlotName, Index))
@@ -575,16 +1814,63 @@ void UAttributeComponent::SaveAttributes(FString SlotName, int32 Index)
 
 void UAttributeComponent::LoadAttributes(FString SlotName, int32 Index)
 {
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Load);
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    if (bAttributesLoading)
+    {
+        PendingLoadSlots.Emplace(SlotName, Index);
+        QueuePendingOperation(EPendingOperationType::LoadFromSlot, FAttributeId());
+        return;
+    }
+
     UAttributeSaveGame* LoadGameInstance = Cast<UAttributeSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, Index));
 
     if (LoadGameInstance)
     {
-        for (auto& AttributePair : AttributeMap)
+        auto RestoreValue = [this](int32 Slot, float SavedValue)
+            {
+                FAttribute& Attribute = Attributes[Slot];
+                const float OldValue = Attribute.Value;
+                Attribute.Value = SavedValue;
+                if (bDeterministic)
+                {
+                    DeterministicStates[Slot].Value = FAttributeFixed::FromFloat(SavedValue);
+                    Attribute.Value = DeterministicStates[Slot].Value.ToFloat();
+                }
+                OnAttributeChanged.Broadcast(Attribute.AttributeTag, Attribute.Value);
+                NotifyAttributeChange(Slot, OldValue, Attribute.Value, EAttributeOperation::Override, EAttributeChangeSource::LoadFromSave);
+            };
+
+        if (LoadGameInstance->SavedIds.Num() > 0)
+        {
+            const int32 NumSaved = FMath::Min3(LoadGameInstance->SavedIds.Num(), LoadGameInstance->SavedTags.Num(), LoadGameInstance->SavedValues.Num());
+            for (int32 SavedIndex = 0; SavedIndex < NumSaved; ++SavedIndex)
+            {
+                const FGameplayTag& SavedTag = LoadGameInstance->SavedTags[SavedIndex];
+
+                // Ids shift when attribute tags are added or removed between builds; remap through the saved tag then
+                FAttributeId AttributeId(LoadGameInstance->SavedIds[SavedIndex]);
+                if (AttributeId.GetTag() != SavedTag)
+                {
+                    AttributeId = FAttributeId::FromTag(SavedTag);
+                }
+
+                const int32 Slot = FindSlot(AttributeId);
+                if (Slot != INDEX_NONE)
+                {
+                    RestoreValue(Slot, LoadGameInstance->SavedValues[SavedIndex]);
+                }
+            }
+        }
+        else
         {
-            if (LoadGameInstance->SavedAttributes.Contains(AttributePair.Key))
+            for (int32 Slot = 0; Slot < Attributes.Num(); ++Slot)
             {
-                AttributePair.Value.Value = LoadGameInstance->SavedAttributes[AttributePair.Key];
-                OnAttributeChanged.Broadcast(AttributePair.Key, AttributePair.Value.Value);
+                if (const float* SavedValue = LoadGameInstance->SavedAttributes.Find(Attributes[Slot].AttributeTag))
+                {
+                    RestoreValue(Slot, *SavedValue);
+                }
             }
         }
 
@@ -596,4 +1882,4 @@ void UAttributeComponent::LoadAttributes(FString SlotName, int32 Index)
 
         SaveAttributes(SlotName, Index);
     }
-}
\ No newline at end of file
+}
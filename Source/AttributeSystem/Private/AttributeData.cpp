@@ -2,4 +2,15 @@
 
 
 #include "AttributeData.h"
+#include "AttributeRegistry.h"
+
+void UAttributeData::PostLoad()
+{
+    Super::PostLoad();
+
+    for (const FAttribute& Attribute : Attributes)
+    {
+        FAttributeRegistry::Get().Register(Attribute.AttributeTag);
+    }
+}
 
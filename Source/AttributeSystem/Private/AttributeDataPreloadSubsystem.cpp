@@ -0,0 +1,78 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeDataPreloadSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeDataPreloadSubsystem)
+
+void UAttributeDataPreloadSubsystem::Deinitialize()
+{
+    ReleasePreloadedAttributeData();
+    Super::Deinitialize();
+}
+
+void UAttributeDataPreloadSubsystem::PreloadAttributeData(const TArray<TSoftObjectPtr<UAttributeData>>& DataAssets)
+{
+    TArray<FSoftObjectPath> AssetPaths;
+    AssetPaths.Reserve(DataAssets.Num());
+    for (const TSoftObjectPtr<UAttributeData>& DataAsset : DataAssets)
+    {
+        if (!DataAsset.IsNull())
+        {
+            AssetPaths.AddUnique(DataAsset.ToSoftObjectPath());
+        }
+    }
+
+    if (AssetPaths.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeDataPreloadSubsystem::PreloadAttributeData - Nothing to preload"));
+        return;
+    }
+
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        AssetPaths,
+        FStreamableDelegate::CreateUObject(this, &UAttributeDataPreloadSubsystem::HandlePreloadCompleted),
+        FStreamableManager::AsyncLoadHighPriority);
+
+    if (Handle.IsValid())
+    {
+        PreloadHandles.Add(Handle);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeDataPreloadSubsystem::PreloadAttributeData - Preloading %d DataAssets"), AssetPaths.Num());
+}
+
+void UAttributeDataPreloadSubsystem::ReleasePreloadedAttributeData()
+{
+    for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+    {
+        if (Handle.IsValid())
+        {
+            Handle->ReleaseHandle();
+        }
+    }
+    PreloadHandles.Empty();
+}
+
+bool UAttributeDataPreloadSubsystem::IsPreloadComplete() const
+{
+    for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+    {
+        if (Handle.IsValid() && Handle->IsLoadingInProgress())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UAttributeDataPreloadSubsystem::HandlePreloadCompleted()
+{
+    if (IsPreloadComplete())
+    {
+        OnAttributeDataPreloaded.Broadcast();
+        UE_LOG(LogTemp, Warning, TEXT("AttributeDataPreloadSubsystem::HandlePreloadCompleted - All preloaded DataAssets are resident"));
+    }
+}
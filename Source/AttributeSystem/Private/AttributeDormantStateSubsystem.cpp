@@ -0,0 +1,246 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeDormantStateSubsystem.h"
+#include "AttributeSystemStats.h"
+#include "Engine/World.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeDormantStateSubsystem)
+
+namespace AttributeDormantState
+{
+    static constexpr int32 Version = 2;
+}
+
+bool UAttributeDormantStateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAttributeDormantStateSubsystem::Deinitialize()
+{
+    ClearStates();
+
+    Super::Deinitialize();
+}
+
+double UAttributeDormantStateSubsystem::GetCurrentTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UAttributeDormantStateSubsystem::StoreState(FName ActorId, FAttributeDormantState&& State)
+{
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    State.CaptureTime = GetCurrentTime();
+    if (!States.Contains(ActorId))
+    {
+        INC_DWORD_STAT(STAT_AttributeSystem_NumDormantStates);
+    }
+    States.Add(ActorId, MoveTemp(State));
+}
+
+bool UAttributeDormantStateSubsystem::TakeState(FName ActorId, FAttributeDormantState& OutState, double& OutElapsed)
+{
+    if (!States.RemoveAndCopyValue(ActorId, OutState))
+    {
+        return false;
+    }
+    DEC_DWORD_STAT(STAT_AttributeSystem_NumDormantStates);
+
+    OutElapsed = FMath::Max(GetCurrentTime() - OutState.CaptureTime, 0.0);
+    return true;
+}
+
+void UAttributeDormantStateSubsystem::ClearStates()
+{
+    DEC_DWORD_STAT_BY(STAT_AttributeSystem_NumDormantStates, States.Num());
+    States.Empty();
+}
+
+TArray<uint8> UAttributeDormantStateSubsystem::SaveDormantStates() const
+{
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+    const_cast<UAttributeDormantStateSubsystem*>(this)->SerializeDormantStates(Writer);
+    return Data;
+}
+
+bool UAttributeDormantStateSubsystem::LoadDormantStates(const TArray<uint8>& Data)
+{
+    FMemoryReader Reader(Data);
+    SerializeDormantStates(Reader);
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeDormantStateSubsystem::LoadDormantStates - Failed to read dormant states"));
+        ClearStates();
+        return false;
+    }
+    return true;
+}
+
+void UAttributeDormantStateSubsystem::SerializeDormantStates(FArchive& Ar)
+{
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    int32 Version = AttributeDormantState::Version;
+    Ar << Version;
+    if (Ar.IsLoading() && Version != AttributeDormantState::Version)
+    {
+        Ar.SetError();
+        return;
+    }
+
+    const double CurrentTime = GetCurrentTime();
+    FAttributeRegistry& Registry = FAttributeRegistry::Get();
+
+    // Tag of every attribute id the stored states reference; ids are written as an index into this table and
+    // remapped through the tag on load
+    TArray<FAttributeId> TableIds;
+    TMap<FAttributeId, uint16> TableIndices;
+    if (Ar.IsSaving())
+    {
+        auto AddTableId = [&TableIds, &TableIndices](FAttributeId AttributeId)
+            {
+                if (!TableIndices.Contains(AttributeId))
+                {
+                    TableIndices.Add(AttributeId, static_cast<uint16>(TableIds.Add(AttributeId)));
+                }
+            };
+
+        for (const TPair<FName, FAttributeDormantState>& Pair : States)
+        {
+            for (const FDormantAttributeValue& Value : Pair.Value.Values)
+            {
+                AddTableId(Value.AttributeId);
+            }
+            for (const FDormantAttributeModifier& Modifier : Pair.Value.Modifiers)
+            {
+                AddTableId(Modifier.AttributeId);
+            }
+        }
+    }
+
+    int32 NumIds = TableIds.Num();
+    Ar << NumIds;
+
+    TArray<FAttributeId> IdRemap;
+    if (Ar.IsLoading())
+    {
+        if (NumIds < 0 || NumIds > FAttributeId::InvalidIndex)
+        {
+            Ar.SetError();
+            return;
+        }
+        IdRemap.Reserve(NumIds);
+    }
+
+    for (int32 IdIndex = 0; IdIndex < NumIds; ++IdIndex)
+    {
+        FName TagName = Ar.IsSaving() ? TableIds[IdIndex].GetTag().GetTagName() : NAME_None;
+        Ar << TagName;
+        if (Ar.IsLoading())
+        {
+            IdRemap.Add(Registry.Register(FGameplayTag::RequestGameplayTag(TagName, false)));
+        }
+    }
+
+    auto SerializeId = [&Ar, &IdRemap, &TableIndices](FAttributeId& AttributeId)
+        {
+            uint16 Index = Ar.IsSaving() ? TableIndices.FindChecked(AttributeId) : 0;
+            Ar << Index;
+            if (Ar.IsLoading())
+            {
+                AttributeId = IdRemap.IsValidIndex(Index) ? IdRemap[Index] : FAttributeId();
+            }
+        };
+
+    int32 NumStates = States.Num();
+    Ar << NumStates;
+
+    if (Ar.IsSaving())
+    {
+        for (TPair<FName, FAttributeDormantState>& Pair : States)
+        {
+            FAttributeDormantState& State = Pair.Value;
+            FName ActorId = Pair.Key;
+            // Stored as time already spent dormant, since world time restarts with the loaded world
+            double Elapsed = CurrentTime - State.CaptureTime;
+            Ar << ActorId;
+            Ar << Elapsed;
+
+            int32 NumValues = State.Values.Num();
+            Ar << NumValues;
+            for (FDormantAttributeValue& Value : State.Values)
+            {
+                SerializeId(Value.AttributeId);
+                Ar << Value.bUseRegen << Value.Value << Value.MinValue << Value.MaxValue;
+            }
+
+            int32 NumModifiers = State.Modifiers.Num();
+            Ar << NumModifiers;
+            for (FDormantAttributeModifier& Modifier : State.Modifiers)
+            {
+                SerializeId(Modifier.AttributeId);
+                Ar << Modifier.Value << Modifier.RemainingTime;
+            }
+        }
+        return;
+    }
+
+    if (NumStates < 0)
+    {
+        Ar.SetError();
+        return;
+    }
+
+    ClearStates();
+    States.Reserve(NumStates);
+    for (int32 StateIndex = 0; StateIndex < NumStates && !Ar.IsError(); ++StateIndex)
+    {
+        FName ActorId;
+        double Elapsed = 0.0;
+        Ar << ActorId;
+        Ar << Elapsed;
+
+        FAttributeDormantState State;
+        State.CaptureTime = CurrentTime - Elapsed;
+
+        int32 NumValues = 0;
+        Ar << NumValues;
+        for (int32 ValueIndex = 0; ValueIndex < NumValues && !Ar.IsError(); ++ValueIndex)
+        {
+            FDormantAttributeValue Value;
+            SerializeId(Value.AttributeId);
+            Ar << Value.bUseRegen << Value.Value << Value.MinValue << Value.MaxValue;
+            if (Value.AttributeId.IsValid())
+            {
+                State.Values.Add(Value);
+            }
+        }
+
+        int32 NumModifiers = 0;
+        Ar << NumModifiers;
+        for (int32 ModifierIndex = 0; ModifierIndex < NumModifiers && !Ar.IsError(); ++ModifierIndex)
+        {
+            FDormantAttributeModifier Modifier;
+            SerializeId(Modifier.AttributeId);
+            Ar << Modifier.Value << Modifier.RemainingTime;
+            if (Modifier.AttributeId.IsValid())
+            {
+                State.Modifiers.Add(Modifier);
+            }
+        }
+
+        if (!States.Contains(ActorId))
+        {
+            INC_DWORD_STAT(STAT_AttributeSystem_NumDormantStates);
+        }
+        States.Add(ActorId, MoveTemp(State));
+    }
+}
@@ -0,0 +1,329 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeEffectSubsystem.h"
+#include "AttributeComponent.h"
+#include "AttributeGameplayTags.h"
+#include "AttributeSystemStats.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeEffectSubsystem)
+
+bool UAttributeEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAttributeEffectSubsystem::Deinitialize()
+{
+    DEC_DWORD_STAT_BY(STAT_AttributeSystem_NumPeriodicEffects, EffectLocations.Num());
+
+    Batches.Empty();
+    EffectLocations.Empty();
+    StackableEffects.Empty();
+    PendingMutations.Empty();
+    PendingMutationIndices.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UAttributeEffectSubsystem::GetStatId() const
+{
+    return GET_STATID(STAT_AttributeSystem_PeriodicEffects);
+}
+
+double UAttributeEffectSubsystem::GetCurrentTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+FPeriodicEffectHandle UAttributeEffectSubsystem::ApplyPeriodicEffect(UAttributeComponent* Target, const FPeriodicAttributeEffect& Effect)
+{
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    FPeriodicEffectHandle Handle;
+    if (!Target || !Effect.AttributeTag.IsValid() || Effect.Period <= 0.0f)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeEffectSubsystem::ApplyPeriodicEffect - Invalid target, attribute or period for effect: %s"), *Effect.EffectTag.ToString());
+        return Handle;
+    }
+
+    if (Target->bDeterministic)
+    {
+        // Deterministic attributes may only change from AdvanceSimulationTick, never from wall-clock time
+        UE_LOG(LogTemp, Warning, TEXT("AttributeEffectSubsystem::ApplyPeriodicEffect - Target is deterministic, effect rejected: %s"), *Effect.EffectTag.ToString());
+        return Handle;
+    }
+
+    const double CurrentTime = GetCurrentTime();
+    const double EndTime = Effect.Duration > 0.0f ? CurrentTime + Effect.Duration : -1.0;
+    const FPeriodicEffectStackKey StackKey(Target, Effect.EffectTag, Effect.Source);
+    const bool bStackable = Effect.Stacking != EPeriodicEffectStacking::Independent && Effect.EffectTag.IsValid();
+
+    if (bStackable)
+    {
+        if (const int32* ExistingId = StackableEffects.Find(StackKey))
+        {
+            const FEffectLocation Location = EffectLocations.FindChecked(*ExistingId);
+            FActivePeriodicEffect& Existing = Batches[Location.Batch].Effects[Location.Index];
+
+            // The latest application defines the effect; stacks and the tick phase carry over
+            Existing.Magnitude = Effect.Magnitude;
+            Existing.MagnitudeCurve = Effect.MagnitudeCurve;
+            Existing.MaxStacks = Effect.MaxStacks;
+            if (Existing.Stacking == EPeriodicEffectStacking::StackMagnitude)
+            {
+                Existing.StackCount = FMath::Min(Existing.StackCount + 1, FMath::Max(Existing.MaxStacks, 1));
+            }
+            Existing.EndTime = EndTime;
+            Handle.Id = Existing.Id;
+
+            const float OldPeriod = Batches[Location.Batch].Period;
+            if (!FMath::IsNearlyEqual(OldPeriod, Effect.Period, 0.001f))
+            {
+                // Next tick is one new period after the last one
+                FActivePeriodicEffect Moved = MoveTemp(Existing);
+                Moved.NextTickTime += Effect.Period - OldPeriod;
+                DetachEffectAt(Location.Batch, Location.Index);
+                AddEffect(MoveTemp(Moved), Effect.Period);
+            }
+
+            UE_LOG(LogTemp, Warning, TEXT("AttributeEffectSubsystem::ApplyPeriodicEffect - Effect %s refreshed, stacks: %d"), *Effect.EffectTag.ToString(), GetStackCount(Handle));
+            return Handle;
+        }
+    }
+
+    FActivePeriodicEffect NewEffect;
+    NewEffect.Id = NextEffectId++;
+    NewEffect.Target = Target;
+    NewEffect.Source = Effect.Source;
+    NewEffect.AttributeId = FAttributeRegistry::Get().Register(Effect.AttributeTag);
+    NewEffect.EffectTag = Effect.EffectTag;
+    NewEffect.Magnitude = Effect.Magnitude;
+    NewEffect.MagnitudeCurve = Effect.MagnitudeCurve;
+    NewEffect.Stacking = bStackable ? Effect.Stacking : EPeriodicEffectStacking::Independent;
+    NewEffect.MaxStacks = Effect.MaxStacks;
+    NewEffect.StackCount = 1;
+    NewEffect.StartTime = CurrentTime;
+    NewEffect.EndTime = EndTime;
+    NewEffect.NextTickTime = CurrentTime + Effect.Period;
+    NewEffect.StackKey = StackKey;
+
+    Handle.Id = NewEffect.Id;
+    if (bStackable)
+    {
+        StackableEffects.Add(StackKey, NewEffect.Id);
+    }
+    AddEffect(MoveTemp(NewEffect), Effect.Period);
+    INC_DWORD_STAT(STAT_AttributeSystem_NumPeriodicEffects);
+
+    return Handle;
+}
+
+bool UAttributeEffectSubsystem::RemovePeriodicEffect(FPeriodicEffectHandle Handle)
+{
+    if (const FEffectLocation* Location = EffectLocations.Find(Handle.Id))
+    {
+        RemoveEffectAt(Location->Batch, Location->Index);
+        return true;
+    }
+    return false;
+}
+
+int32 UAttributeEffectSubsystem::RemovePeriodicEffectsByTag(UAttributeComponent* Target, FGameplayTag EffectTag)
+{
+    int32 NumRemoved = 0;
+    for (int32 Batch = 0; Batch < Batches.Num(); ++Batch)
+    {
+        TArray<FActivePeriodicEffect>& Effects = Batches[Batch].Effects;
+        for (int32 Index = Effects.Num() - 1; Index >= 0; --Index)
+        {
+            if (Effects[Index].Target.Get() == Target && Effects[Index].EffectTag.MatchesTag(EffectTag))
+            {
+                RemoveEffectAt(Batch, Index);
+                ++NumRemoved;
+            }
+        }
+    }
+    return NumRemoved;
+}
+
+int32 UAttributeEffectSubsystem::RemoveAllPeriodicEffects(UAttributeComponent* Target)
+{
+    int32 NumRemoved = 0;
+    for (int32 Batch = 0; Batch < Batches.Num(); ++Batch)
+    {
+        TArray<FActivePeriodicEffect>& Effects = Batches[Batch].Effects;
+        for (int32 Index = Effects.Num() - 1; Index >= 0; --Index)
+        {
+            if (Effects[Index].Target.Get() == Target)
+            {
+                RemoveEffectAt(Batch, Index);
+                ++NumRemoved;
+            }
+        }
+    }
+    return NumRemoved;
+}
+
+int32 UAttributeEffectSubsystem::GetStackCount(FPeriodicEffectHandle Handle) const
+{
+    if (const FEffectLocation* Location = EffectLocations.Find(Handle.Id))
+    {
+        return Batches[Location->Batch].Effects[Location->Index].StackCount;
+    }
+    return 0;
+}
+
+int32 UAttributeEffectSubsystem::FindOrAddBatch(float Period)
+{
+    for (int32 Batch = 0; Batch < Batches.Num(); ++Batch)
+    {
+        if (FMath::IsNearlyEqual(Batches[Batch].Period, Period, 0.001f))
+        {
+            return Batch;
+        }
+    }
+
+    FPeriodicEffectBatch& NewBatch = Batches.AddDefaulted_GetRef();
+    NewBatch.Period = Period;
+    return Batches.Num() - 1;
+}
+
+void UAttributeEffectSubsystem::AddEffect(FActivePeriodicEffect&& Effect, float Period)
+{
+    const int32 Batch = FindOrAddBatch(Period);
+    FPeriodicEffectBatch& EffectBatch = Batches[Batch];
+    EffectBatch.NextTickTime = EffectBatch.Effects.Num() > 0 ? FMath::Min(EffectBatch.NextTickTime, Effect.NextTickTime) : Effect.NextTickTime;
+
+    const int32 EffectId = Effect.Id;
+    const int32 Index = EffectBatch.Effects.Add(MoveTemp(Effect));
+    EffectLocations.Add(EffectId, { Batch, Index });
+}
+
+void UAttributeEffectSubsystem::DetachEffectAt(int32 Batch, int32 Index)
+{
+    TArray<FActivePeriodicEffect>& Effects = Batches[Batch].Effects;
+    EffectLocations.Remove(Effects[Index].Id);
+
+    Effects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Effects.IsValidIndex(Index))
+    {
+        EffectLocations.FindChecked(Effects[Index].Id).Index = Index;
+    }
+}
+
+void UAttributeEffectSubsystem::RemoveEffectAt(int32 Batch, int32 Index)
+{
+    const FActivePeriodicEffect& Effect = Batches[Batch].Effects[Index];
+    if (Effect.Stacking != EPeriodicEffectStacking::Independent)
+    {
+        const int32* StackedId = StackableEffects.Find(Effect.StackKey);
+        if (StackedId && *StackedId == Effect.Id)
+        {
+            StackableEffects.Remove(Effect.StackKey);
+        }
+    }
+
+    DetachEffectAt(Batch, Index);
+    DEC_DWORD_STAT(STAT_AttributeSystem_NumPeriodicEffects);
+}
+
+void UAttributeEffectSubsystem::Tick(float DeltaTime)
+{
+    const double CurrentTime = GetCurrentTime();
+
+    for (int32 Batch = 0; Batch < Batches.Num(); ++Batch)
+    {
+        if (Batches[Batch].Effects.Num() > 0 && CurrentTime >= Batches[Batch].NextTickTime)
+        {
+            TickBatch(Batch, CurrentTime);
+        }
+    }
+
+    ApplyMutations();
+}
+
+void UAttributeEffectSubsystem::TickBatch(int32 Batch, double CurrentTime)
+{
+    FPeriodicEffectBatch& EffectBatch = Batches[Batch];
+    const float Period = EffectBatch.Period;
+    double EarliestNextTickTime = TNumericLimits<double>::Max();
+
+    for (int32 Index = EffectBatch.Effects.Num() - 1; Index >= 0; --Index)
+    {
+        FActivePeriodicEffect& Effect = EffectBatch.Effects[Index];
+        UAttributeComponent* Target = Effect.Target.Get();
+        if (!Target)
+        {
+            RemoveEffectAt(Batch, Index);
+            continue;
+        }
+
+        // A long frame can cover several periods; every elapsed tick is applied in this frame's mutation pass
+        const double LastDueTime = Effect.EndTime >= 0.0 ? FMath::Min(CurrentTime, Effect.EndTime) : CurrentTime;
+        float Delta = 0.0f;
+        for (; Effect.NextTickTime <= LastDueTime; Effect.NextTickTime += Period)
+        {
+            const float Scale = Effect.MagnitudeCurve ? Effect.MagnitudeCurve->GetFloatValue(static_cast<float>(Effect.NextTickTime - Effect.StartTime)) : 1.0f;
+            Delta += Effect.Magnitude * Scale * Effect.StackCount;
+        }
+
+        if (Delta != 0.0f)
+        {
+            AddMutation(Target, Effect.AttributeId, Delta);
+        }
+
+        if (Effect.EndTime >= 0.0 && Effect.EndTime < Effect.NextTickTime)
+        {
+            RemoveEffectAt(Batch, Index);
+            continue;
+        }
+        EarliestNextTickTime = FMath::Min(EarliestNextTickTime, Effect.NextTickTime);
+    }
+
+    EffectBatch.NextTickTime = EarliestNextTickTime;
+}
+
+void UAttributeEffectSubsystem::AddMutation(UAttributeComponent* Target, FAttributeId AttributeId, float Delta)
+{
+    const TPair<const UAttributeComponent*, uint16> Key(Target, AttributeId.GetIndex());
+    if (const int32* MutationIndex = PendingMutationIndices.Find(Key))
+    {
+        PendingMutations[*MutationIndex].Delta += Delta;
+        return;
+    }
+
+    PendingMutationIndices.Add(Key, PendingMutations.Add({ Target, AttributeId, Delta }));
+}
+
+void UAttributeEffectSubsystem::ApplyMutations()
+{
+    if (PendingMutations.Num() == 0)
+    {
+        return;
+    }
+
+    const FAttributeId HealthId = FAttributeId::FromTag(AttributeTags::Health);
+
+    // Handlers bound to attribute changes may apply or remove effects, so work on a detached list
+    TArray<FPendingMutation> Mutations = MoveTemp(PendingMutations);
+    PendingMutationIndices.Reset();
+
+    for (const FPendingMutation& Mutation : Mutations)
+    {
+        UAttributeComponent* Target = Mutation.Target.Get();
+        if (!Target || Mutation.Delta == 0.0f)
+        {
+            continue;
+        }
+
+        // Lethal damage over time still broadcasts OnDeath, as DecreaseHealth would
+        Target->ApplyEffectDelta(Mutation.AttributeId, Mutation.Delta, Mutation.AttributeId == HealthId && Mutation.Delta < 0.0f);
+    }
+
+    Mutations.Reset();
+    PendingMutations = MoveTemp(Mutations);
+}
@@ -0,0 +1,429 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeQuerySubsystem.h"
+#include "AttributeComponent.h"
+#include "AttributeSystemStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeQuerySubsystem)
+
+namespace AttributeQuery
+{
+    static float GridCellSize = 2000.0f;
+    static FAutoConsoleVariableRef CVarGridCellSize(
+        TEXT("AttributeSystem.Query.GridCellSize"),
+        GridCellSize,
+        TEXT("Edge length in world units of the coarse grid cells used by spatial attribute queries."));
+
+    static float GridRefreshInterval = 0.25f;
+    static FAutoConsoleVariableRef CVarGridRefreshInterval(
+        TEXT("AttributeSystem.Query.GridRefreshInterval"),
+        GridRefreshInterval,
+        TEXT("Seconds after which the spatial query grid is considered stale and rebuilt on the next spatial query."));
+}
+
+void UAttributeQuerySubsystem::FTagIndex::Add(UAttributeComponent* Component, float Normalized)
+{
+    const int32 Bucket = GetBucket(Normalized);
+    const int32 Index = Buckets[Bucket].Add({ Component, Normalized });
+    Locations.Add(Component, { Bucket, Index });
+}
+
+void UAttributeQuerySubsystem::FTagIndex::Remove(UAttributeComponent* Component)
+{
+    FEntryLocation Location;
+    if (!Locations.RemoveAndCopyValue(Component, Location))
+    {
+        return;
+    }
+
+    TArray<FIndexedEntry>& Bucket = Buckets[Location.Bucket];
+    Bucket.RemoveAtSwap(Location.Index, 1, EAllowShrinking::No);
+    if (Bucket.IsValidIndex(Location.Index))
+    {
+        Locations.FindChecked(Bucket[Location.Index].Component).Index = Location.Index;
+    }
+}
+
+const UAttributeQuerySubsystem::FIndexedEntry* UAttributeQuerySubsystem::FTagIndex::Find(UAttributeComponent* Component) const
+{
+    if (const FEntryLocation* Location = Locations.Find(Component))
+    {
+        return &Buckets[Location->Bucket][Location->Index];
+    }
+    return nullptr;
+}
+
+int32 UAttributeQuerySubsystem::GetBucket(float Normalized)
+{
+    return FMath::Clamp(FMath::FloorToInt(Normalized * NumBuckets), 0, NumBuckets - 1);
+}
+
+const UAttributeQuerySubsystem::FTagIndex* UAttributeQuerySubsystem::FindTagIndex(const FGameplayTag& AttributeTag) const
+{
+    const FAttributeId AttributeId = FAttributeId::FromTag(AttributeTag);
+    return AttributeId.IsValid() && TagIndexes.IsValidIndex(AttributeId.GetIndex()) ? &TagIndexes[AttributeId.GetIndex()] : nullptr;
+}
+
+bool UAttributeQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAttributeQuerySubsystem::Deinitialize()
+{
+    TagIndexes.Empty();
+    RegisteredComponents.Empty();
+    ComponentCells.Empty();
+    Grid.Empty();
+    Super::Deinitialize();
+}
+
+void UAttributeQuerySubsystem::UpdateAttribute(UAttributeComponent* Component, FAttributeId AttributeId, float Normalized)
+{
+    if (!AttributeId.IsValid())
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    if (AttributeId.GetIndex() >= TagIndexes.Num())
+    {
+        TagIndexes.SetNum(AttributeId.GetIndex() + 1);
+    }
+
+    FTagIndex& TagIndex = TagIndexes[AttributeId.GetIndex()];
+    if (const FEntryLocation* Location = TagIndex.Locations.Find(Component))
+    {
+        if (Location->Bucket == GetBucket(Normalized))
+        {
+            TagIndex.Buckets[Location->Bucket][Location->Index].Normalized = Normalized;
+            return;
+        }
+        TagIndex.Remove(Component);
+    }
+
+    TagIndex.Add(Component, Normalized);
+
+    const bool bAlreadyRegistered = RegisteredComponents.Contains(Component);
+    RegisteredComponents.FindOrAdd(Component).AddUnique(AttributeId);
+    if (!bAlreadyRegistered && LastGridBuildTime >= 0.0)
+    {
+        // Make new components visible to spatial queries without waiting for the next rebuild
+        if (const AActor* Owner = Component->GetOwner())
+        {
+            const FIntPoint Cell = GetCell(Owner->GetActorLocation());
+            Grid.FindOrAdd(Cell).Add(Component);
+            ComponentCells.Add(Component, Cell);
+        }
+    }
+}
+
+void UAttributeQuerySubsystem::RemoveAttribute(UAttributeComponent* Component, FAttributeId AttributeId)
+{
+    if (AttributeId.IsValid() && TagIndexes.IsValidIndex(AttributeId.GetIndex()))
+    {
+        TagIndexes[AttributeId.GetIndex()].Remove(Component);
+    }
+
+    if (TArray<FAttributeId>* IndexedIds = RegisteredComponents.Find(Component))
+    {
+        IndexedIds->RemoveSingleSwap(AttributeId, EAllowShrinking::No);
+    }
+}
+
+void UAttributeQuerySubsystem::RemoveComponent(UAttributeComponent* Component)
+{
+    TArray<FAttributeId> IndexedIds;
+    if (RegisteredComponents.RemoveAndCopyValue(Component, IndexedIds))
+    {
+        for (const FAttributeId AttributeId : IndexedIds)
+        {
+            TagIndexes[AttributeId.GetIndex()].Remove(Component);
+        }
+    }
+
+    FIntPoint Cell;
+    if (ComponentCells.RemoveAndCopyValue(Component, Cell))
+    {
+        if (TArray<TWeakObjectPtr<UAttributeComponent>>* CellComponents = Grid.Find(Cell))
+        {
+            CellComponents->RemoveSingleSwap(Component, EAllowShrinking::No);
+            if (CellComponents->Num() == 0)
+            {
+                Grid.Remove(Cell);
+            }
+        }
+    }
+}
+
+void UAttributeQuerySubsystem::QueryInRange(FGameplayTag AttributeTag, float MinNormalized, float MaxNormalized, FVector Origin, float Radius, TArray<UAttributeComponent*>& OutComponents)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Query);
+
+    OutComponents.Reset();
+
+    const FTagIndex* TagIndex = FindTagIndex(AttributeTag);
+    if (!TagIndex || MinNormalized > MaxNormalized)
+    {
+        return;
+    }
+
+    const int32 MinBucket = GetBucket(MinNormalized);
+    const int32 MaxBucket = GetBucket(MaxNormalized);
+    const bool bSpatial = Radius > 0.0f;
+    const float RadiusSquared = FMath::Square(Radius);
+
+    if (bSpatial)
+    {
+        int32 ValueCandidateCount = 0;
+        for (int32 Bucket = MinBucket; Bucket <= MaxBucket; ++Bucket)
+        {
+            ValueCandidateCount += TagIndex->Buckets[Bucket].Num();
+        }
+
+        TArray<UAttributeComponent*> SpatialCandidates;
+        if (GatherSpatialCandidates(Origin, Radius, ValueCandidateCount, SpatialCandidates))
+        {
+            for (UAttributeComponent* Component : SpatialCandidates)
+            {
+                const FIndexedEntry* Entry = TagIndex->Find(Component);
+                if (Entry && Entry->Normalized >= MinNormalized && Entry->Normalized <= MaxNormalized && IsWithinRadius(Component, Origin, RadiusSquared))
+                {
+                    OutComponents.Add(Component);
+                }
+            }
+            return;
+        }
+    }
+
+    for (int32 Bucket = MinBucket; Bucket <= MaxBucket; ++Bucket)
+    {
+        // Inner buckets lie entirely inside the range; only the two boundary buckets need a value test
+        const bool bBoundary = Bucket == MinBucket || Bucket == MaxBucket;
+        for (const FIndexedEntry& Entry : TagIndex->Buckets[Bucket])
+        {
+            if (bBoundary && (Entry.Normalized < MinNormalized || Entry.Normalized > MaxNormalized))
+            {
+                continue;
+            }
+            UAttributeComponent* Component = Entry.Component.Get();
+            if (!Component || (bSpatial && !IsWithinRadius(Component, Origin, RadiusSquared)))
+            {
+                continue;
+            }
+            OutComponents.Add(Component);
+        }
+    }
+}
+
+void UAttributeQuerySubsystem::FindLowest(FGameplayTag AttributeTag, int32 Count, FVector Origin, float Radius, TArray<UAttributeComponent*>& OutComponents)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Query);
+
+    OutComponents.Reset();
+
+    const FTagIndex* TagIndex = FindTagIndex(AttributeTag);
+    if (!TagIndex || Count <= 0)
+    {
+        return;
+    }
+
+    const bool bSpatial = Radius > 0.0f;
+    const float RadiusSquared = FMath::Square(Radius);
+    TArray<FIndexedEntry> Candidates;
+
+    if (bSpatial)
+    {
+        TArray<UAttributeComponent*> SpatialCandidates;
+        if (GatherSpatialCandidates(Origin, Radius, TagIndex->Locations.Num(), SpatialCandidates))
+        {
+            for (UAttributeComponent* Component : SpatialCandidates)
+            {
+                const FIndexedEntry* Entry = TagIndex->Find(Component);
+                if (Entry && IsWithinRadius(Component, Origin, RadiusSquared))
+                {
+                    Candidates.Add(*Entry);
+                }
+            }
+
+            Candidates.Sort([](const FIndexedEntry& A, const FIndexedEntry& B) { return A.Normalized < B.Normalized; });
+            for (int32 Index = 0; Index < Candidates.Num() && OutComponents.Num() < Count; ++Index)
+            {
+                OutComponents.Add(Candidates[Index].Component.Get());
+            }
+            return;
+        }
+    }
+
+    // Buckets are ordered, so only the bucket that completes the result needs sorting beyond its own contents
+    for (int32 Bucket = 0; Bucket < NumBuckets && OutComponents.Num() < Count; ++Bucket)
+    {
+        Candidates.Reset();
+        for (const FIndexedEntry& Entry : TagIndex->Buckets[Bucket])
+        {
+            const UAttributeComponent* Component = Entry.Component.Get();
+            if (Component && (!bSpatial || IsWithinRadius(Component, Origin, RadiusSquared)))
+            {
+                Candidates.Add(Entry);
+            }
+        }
+
+        Candidates.Sort([](const FIndexedEntry& A, const FIndexedEntry& B) { return A.Normalized < B.Normalized; });
+        for (int32 Index = 0; Index < Candidates.Num() && OutComponents.Num() < Count; ++Index)
+        {
+            OutComponents.Add(Candidates[Index].Component.Get());
+        }
+    }
+}
+
+int32 UAttributeQuerySubsystem::CountInRange(FGameplayTag AttributeTag, float MinNormalized, float MaxNormalized, FVector Origin, float Radius)
+{
+    const FTagIndex* TagIndex = FindTagIndex(AttributeTag);
+    if (!TagIndex || MinNormalized > MaxNormalized)
+    {
+        return 0;
+    }
+
+    if (Radius > 0.0f)
+    {
+        TArray<UAttributeComponent*> Components;
+        QueryInRange(AttributeTag, MinNormalized, MaxNormalized, Origin, Radius, Components);
+        return Components.Num();
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_Query);
+
+    const int32 MinBucket = GetBucket(MinNormalized);
+    const int32 MaxBucket = GetBucket(MaxNormalized);
+    int32 Result = 0;
+
+    for (int32 Bucket = MinBucket; Bucket <= MaxBucket; ++Bucket)
+    {
+        if (Bucket != MinBucket && Bucket != MaxBucket)
+        {
+            Result += TagIndex->Buckets[Bucket].Num();
+            continue;
+        }
+
+        for (const FIndexedEntry& Entry : TagIndex->Buckets[Bucket])
+        {
+            if (Entry.Normalized >= MinNormalized && Entry.Normalized <= MaxNormalized)
+            {
+                ++Result;
+            }
+        }
+    }
+
+    return Result;
+}
+
+void UAttributeQuerySubsystem::RefreshGridIfStale()
+{
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+    if (LastGridBuildTime >= 0.0 && Now - LastGridBuildTime < AttributeQuery::GridRefreshInterval && GridCellSize == AttributeQuery::GridCellSize)
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    GridCellSize = FMath::Max(AttributeQuery::GridCellSize, 1.0f);
+    LastGridBuildTime = Now;
+
+    for (TPair<FIntPoint, TArray<TWeakObjectPtr<UAttributeComponent>>>& Cell : Grid)
+    {
+        Cell.Value.Reset();
+    }
+    ComponentCells.Reset();
+
+    for (auto It = RegisteredComponents.CreateIterator(); It; ++It)
+    {
+        UAttributeComponent* Component = It->Key.Get();
+        if (!Component)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (const AActor* Owner = Component->GetOwner())
+        {
+            const FIntPoint Cell = GetCell(Owner->GetActorLocation());
+            Grid.FindOrAdd(Cell).Add(Component);
+            ComponentCells.Add(Component, Cell);
+        }
+    }
+
+    // Cells everyone moved out of would otherwise inflate Grid.Num() in GatherSpatialCandidates
+    for (auto It = Grid.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+FIntPoint UAttributeQuerySubsystem::GetCell(const FVector& Location) const
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / GridCellSize), FMath::FloorToInt(Location.Y / GridCellSize));
+}
+
+bool UAttributeQuerySubsystem::GatherSpatialCandidates(const FVector& Origin, float Radius, int32 ValueCandidateCount, TArray<UAttributeComponent*>& OutCandidates)
+{
+    RefreshGridIfStale();
+
+    // Pad by one cell so actors that moved since the last rebuild are still considered
+    const FIntPoint MinCell = GetCell(Origin - FVector(Radius, Radius, 0.0f)) - FIntPoint(1, 1);
+    const FIntPoint MaxCell = GetCell(Origin + FVector(Radius, Radius, 0.0f)) + FIntPoint(1, 1);
+
+    const int64 NumCells = static_cast<int64>(MaxCell.X - MinCell.X + 1) * static_cast<int64>(MaxCell.Y - MinCell.Y + 1);
+    if (NumCells > Grid.Num() + ValueCandidateCount)
+    {
+        return false;
+    }
+
+    TArray<const TArray<TWeakObjectPtr<UAttributeComponent>>*, TInlineAllocator<16>> Cells;
+    int32 SpatialCandidateCount = 0;
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            if (const TArray<TWeakObjectPtr<UAttributeComponent>>* Cell = Grid.Find(FIntPoint(X, Y)))
+            {
+                Cells.Add(Cell);
+                SpatialCandidateCount += Cell->Num();
+            }
+        }
+    }
+
+    if (SpatialCandidateCount >= ValueCandidateCount)
+    {
+        return false;
+    }
+
+    OutCandidates.Reserve(SpatialCandidateCount);
+    for (const TArray<TWeakObjectPtr<UAttributeComponent>>* Cell : Cells)
+    {
+        for (const TWeakObjectPtr<UAttributeComponent>& CellComponent : *Cell)
+        {
+            if (UAttributeComponent* Component = CellComponent.Get())
+            {
+                OutCandidates.Add(Component);
+            }
+        }
+    }
+    return true;
+}
+
+bool UAttributeQuerySubsystem::IsWithinRadius(const UAttributeComponent* Component, const FVector& Origin, float RadiusSquared)
+{
+    const AActor* Owner = Component->GetOwner();
+    return Owner && FVector::DistSquared(Owner->GetActorLocation(), Origin) <= RadiusSquared;
+}
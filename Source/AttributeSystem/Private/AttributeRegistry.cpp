@@ -0,0 +1,184 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeRegistry.h"
+#include "AttributeSystemStats.h"
+#include "GameplayTagsManager.h"
+#include "Misc/ScopeRWLock.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeRegistry)
+
+FAttributeId FAttributeId::FromTag(const FGameplayTag& AttributeTag)
+{
+    return FAttributeRegistry::Get().Find(AttributeTag);
+}
+
+FGameplayTag FAttributeId::GetTag() const
+{
+    return FAttributeRegistry::Get().GetTag(*this);
+}
+
+bool FAttributeId::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    FAttributeRegistry& Registry = FAttributeRegistry::Get();
+
+    uint16 NetIndex = Ar.IsSaving() && Registry.IsStable(*this) ? Index : InvalidIndex;
+    Ar << NetIndex;
+    bOutSuccess = true;
+
+    if (NetIndex != InvalidIndex)
+    {
+        if (Ar.IsLoading())
+        {
+            Index = NetIndex;
+        }
+        return true;
+    }
+
+    // Invalid or process-local id; the tag is what identifies the attribute on the other end
+    FGameplayTag AttributeTag = Ar.IsSaving() ? GetTag() : FGameplayTag();
+    AttributeTag.NetSerialize(Ar, Map, bOutSuccess);
+    if (Ar.IsLoading())
+    {
+        *this = Registry.Register(AttributeTag);
+    }
+    return true;
+}
+
+FAttributeRegistry& FAttributeRegistry::Get()
+{
+    static FAttributeRegistry Instance;
+    return Instance;
+}
+
+FAttributeId FAttributeRegistry::Register(const FGameplayTag& AttributeTag)
+{
+    if (!AttributeTag.IsValid())
+    {
+        return FAttributeId();
+    }
+
+    if (bFrozen.load(std::memory_order_acquire))
+    {
+        if (const FAttributeId* FoundId = FrozenIdsByTag.Find(AttributeTag))
+        {
+            return *FoundId;
+        }
+    }
+
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const FAttributeId* FoundId = IdsByTag.Find(AttributeTag))
+        {
+            return *FoundId;
+        }
+    }
+
+    LLM_SCOPE_BYTAG(AttributeSystem);
+    FWriteScopeLock WriteLock(Lock);
+
+    if (const FAttributeId* FoundId = IdsByTag.Find(AttributeTag))
+    {
+        return *FoundId;
+    }
+
+    if (Tags.Num() >= FAttributeId::InvalidIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeRegistry::Register - Out of attribute ids, cannot register: %s"), *AttributeTag.ToString());
+        return FAttributeId();
+    }
+
+    const FAttributeId NewId(static_cast<uint16>(Tags.Add(AttributeTag)));
+    IdsByTag.Add(AttributeTag, NewId);
+    if (bFrozen.load(std::memory_order_relaxed))
+    {
+        bHasLateTags.store(true, std::memory_order_release);
+    }
+    return NewId;
+}
+
+FAttributeId FAttributeRegistry::Find(const FGameplayTag& AttributeTag) const
+{
+    if (bFrozen.load(std::memory_order_acquire))
+    {
+        if (const FAttributeId* FoundId = FrozenIdsByTag.Find(AttributeTag))
+        {
+            return *FoundId;
+        }
+        if (!bHasLateTags.load(std::memory_order_acquire))
+        {
+            return FAttributeId();
+        }
+    }
+
+    FReadScopeLock ReadLock(Lock);
+    const FAttributeId* FoundId = IdsByTag.Find(AttributeTag);
+    return FoundId ? *FoundId : FAttributeId();
+}
+
+FGameplayTag FAttributeRegistry::GetTag(FAttributeId AttributeId) const
+{
+    if (bFrozen.load(std::memory_order_acquire) && FrozenTags.IsValidIndex(AttributeId.GetIndex()))
+    {
+        return FrozenTags[AttributeId.GetIndex()];
+    }
+
+    FReadScopeLock ReadLock(Lock);
+    return Tags.IsValidIndex(AttributeId.GetIndex()) ? Tags[AttributeId.GetIndex()] : FGameplayTag();
+}
+
+int32 FAttributeRegistry::Num() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return Tags.Num();
+}
+
+bool FAttributeRegistry::IsStable(FAttributeId AttributeId) const
+{
+    return bFrozen.load(std::memory_order_acquire) && FrozenTags.IsValidIndex(AttributeId.GetIndex());
+}
+
+void FAttributeRegistry::RegisterNativeTags()
+{
+    TArray<FGameplayTag> AttributeTags;
+    const FGameplayTag RootTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Attribute")), false);
+    if (RootTag.IsValid())
+    {
+        UGameplayTagsManager::Get().RequestGameplayTagChildren(RootTag).GetGameplayTagArray(AttributeTags);
+    }
+
+    {
+        LLM_SCOPE_BYTAG(AttributeSystem);
+        FWriteScopeLock WriteLock(Lock);
+        if (bFrozen.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Data assets loaded before native tags were done registered their tags in load order. They are renumbered
+        // along with the native tags so the frozen ids only depend on which tags exist; PostLoad keeps no ids.
+        for (const FGameplayTag& AttributeTag : Tags)
+        {
+            AttributeTags.AddUnique(AttributeTag);
+        }
+        AttributeTags.Sort([](const FGameplayTag& A, const FGameplayTag& B) { return A.GetTagName().LexicalLess(B.GetTagName()); });
+
+        Tags.Reset(AttributeTags.Num());
+        IdsByTag.Reset();
+        for (const FGameplayTag& AttributeTag : AttributeTags)
+        {
+            if (Tags.Num() >= FAttributeId::InvalidIndex)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("AttributeRegistry::RegisterNativeTags - Out of attribute ids, cannot register: %s"), *AttributeTag.ToString());
+                break;
+            }
+            IdsByTag.Add(AttributeTag, FAttributeId(static_cast<uint16>(Tags.Add(AttributeTag))));
+        }
+
+        FrozenIdsByTag = IdsByTag;
+        FrozenTags = Tags;
+        bFrozen.store(true, std::memory_order_release);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeRegistry::RegisterNativeTags - %d attribute ids registered"), Num());
+}
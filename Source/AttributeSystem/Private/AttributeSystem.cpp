@@ -1,18 +1,32 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AttributeSystem.h"
+#include "AttributeTelemetry.h"
+#include "AttributeRegistry.h"
+#include "GameplayTagsManager.h"
+#include "Misc/CommandLine.h"
 
 #define LOCTEXT_NAMESPACE "FAttributeSystemModule"
 
 void FAttributeSystemModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	UGameplayTagsManager::Get().CallOrRegister_OnDoneAddingNativeTagsDelegate(FSimpleMulticastDelegate::FDelegate::CreateLambda([]()
+		{
+			FAttributeRegistry::Get().RegisterNativeTags();
+		}));
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("AttributeTelemetry")))
+	{
+		FAttributeTelemetryRecorder::Get().Start();
+	}
 }
 
 void FAttributeSystemModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FAttributeTelemetryRecorder::Get().Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,64 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeSystemStats.h"
+#include "AttributeTelemetry.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+
+DEFINE_STAT(STAT_AttributeSystem_SetAttribute);
+DEFINE_STAT(STAT_AttributeSystem_Regen);
+DEFINE_STAT(STAT_AttributeSystem_ApplyModifier);
+DEFINE_STAT(STAT_AttributeSystem_RemoveModifier);
+DEFINE_STAT(STAT_AttributeSystem_LoadFromDataAsset);
+DEFINE_STAT(STAT_AttributeSystem_Save);
+DEFINE_STAT(STAT_AttributeSystem_Load);
+DEFINE_STAT(STAT_AttributeSystem_Query);
+DEFINE_STAT(STAT_AttributeSystem_TelemetryFlush);
+DEFINE_STAT(STAT_AttributeSystem_SimulationTick);
+DEFINE_STAT(STAT_AttributeSystem_ViewModelFlush);
+DEFINE_STAT(STAT_AttributeSystem_PeriodicEffects);
+DEFINE_STAT(STAT_AttributeSystem_UpdatePhase);
+DEFINE_STAT(STAT_AttributeSystem_UpdatePhaseDispatch);
+DEFINE_STAT(STAT_AttributeSystem_DormantRestore);
+DEFINE_STAT(STAT_AttributeSystem_TryConsume);
+DEFINE_STAT(STAT_AttributeSystem_GroupQuery);
+
+DEFINE_STAT(STAT_AttributeSystem_NumComponents);
+DEFINE_STAT(STAT_AttributeSystem_NumAttributes);
+DEFINE_STAT(STAT_AttributeSystem_NumActiveModifiers);
+DEFINE_STAT(STAT_AttributeSystem_NumRegenEntries);
+DEFINE_STAT(STAT_AttributeSystem_NumPeriodicEffects);
+DEFINE_STAT(STAT_AttributeSystem_NumDormantStates);
+
+LLM_DEFINE_TAG(AttributeSystem);
+
+UE_TRACE_CHANNEL_DEFINE(AttributeSystemChannel);
+
+UE_TRACE_EVENT_BEGIN(AttributeSystem, AttributeChanged)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, ComponentId)
+    UE_TRACE_EVENT_FIELD(uint8, Source)
+    UE_TRACE_EVENT_FIELD(float, OldValue)
+    UE_TRACE_EVENT_FIELD(float, NewValue)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, AttributeTag)
+UE_TRACE_EVENT_END()
+
+void AttributeSystemTrace::OutputAttributeChanged(const UObject* Component, const FGameplayTag& AttributeTag, float OldValue, float NewValue, EAttributeChangeSource Source)
+{
+#if UE_TRACE_ENABLED
+    if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(AttributeSystemChannel))
+    {
+        return;
+    }
+
+    const FString TagString = AttributeTag.ToString();
+    UE_TRACE_LOG(AttributeSystem, AttributeChanged, AttributeSystemChannel)
+        << AttributeChanged.Cycle(FPlatformTime::Cycles64())
+        << AttributeChanged.ComponentId(Component ? Component->GetUniqueID() : 0)
+        << AttributeChanged.Source(static_cast<uint8>(Source))
+        << AttributeChanged.OldValue(OldValue)
+        << AttributeChanged.NewValue(NewValue)
+        << AttributeChanged.AttributeTag(*TagString, TagString.Len());
+#endif
+}
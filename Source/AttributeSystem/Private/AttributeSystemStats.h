@@ -0,0 +1,48 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Trace/Trace.h"
+
+struct FGameplayTag;
+enum class EAttributeChangeSource : uint8;
+
+DECLARE_STATS_GROUP(TEXT("AttributeSystem"), STATGROUP_AttributeSystem, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Set Attribute"), STAT_AttributeSystem_SetAttribute, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Regenerate Attributes"), STAT_AttributeSystem_Regen, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Modifier"), STAT_AttributeSystem_ApplyModifier, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Remove Modifier"), STAT_AttributeSystem_RemoveModifier, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load From Data Asset"), STAT_AttributeSystem_LoadFromDataAsset, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Attributes"), STAT_AttributeSystem_Save, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load Attributes"), STAT_AttributeSystem_Load, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Attribute Query"), STAT_AttributeSystem_Query, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Telemetry Flush"), STAT_AttributeSystem_TelemetryFlush, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Simulation Tick"), STAT_AttributeSystem_SimulationTick, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("View Model Flush"), STAT_AttributeSystem_ViewModelFlush, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Periodic Effects"), STAT_AttributeSystem_PeriodicEffects, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Phase"), STAT_AttributeSystem_UpdatePhase, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Phase Dispatch"), STAT_AttributeSystem_UpdatePhaseDispatch, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dormant State Restore"), STAT_AttributeSystem_DormantRestore, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Try Consume"), STAT_AttributeSystem_TryConsume, STATGROUP_AttributeSystem, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Group Query"), STAT_AttributeSystem_GroupQuery, STATGROUP_AttributeSystem, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Components"), STAT_AttributeSystem_NumComponents, STATGROUP_AttributeSystem, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attributes"), STAT_AttributeSystem_NumAttributes, STATGROUP_AttributeSystem, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Modifiers"), STAT_AttributeSystem_NumActiveModifiers, STATGROUP_AttributeSystem, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Regen Entries"), STAT_AttributeSystem_NumRegenEntries, STATGROUP_AttributeSystem, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Periodic Effects"), STAT_AttributeSystem_NumPeriodicEffects, STATGROUP_AttributeSystem, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dormant States"), STAT_AttributeSystem_NumDormantStates, STATGROUP_AttributeSystem, );
+
+LLM_DECLARE_TAG(AttributeSystem);
+
+UE_TRACE_CHANNEL_EXTERN(AttributeSystemChannel);
+
+namespace AttributeSystemTrace
+{
+    /** Emits an AttributeSystem.AttributeChanged event when the AttributeSystem trace channel is enabled. */
+    void OutputAttributeChanged(const UObject* Component, const FGameplayTag& AttributeTag, float OldValue, float NewValue, EAttributeChangeSource Source);
+}
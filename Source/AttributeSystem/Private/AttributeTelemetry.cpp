@@ -0,0 +1,492 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeTelemetry.h"
+#include "AttributeComponent.h"
+#include "AttributeSystemStats.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+
+namespace AttributeTelemetry
+{
+    static constexpr uint32 FileMagic = 0x4D4C5441; // 'ATLM'
+    static constexpr uint32 FileVersion = 1;
+
+    enum class EBlockType : uint8
+    {
+        TagName = 0,
+        ActorName = 1,
+        Records = 2
+    };
+
+    static int32 MaxFileSizeMB = 64;
+    static FAutoConsoleVariableRef CVarMaxFileSizeMB(
+        TEXT("AttributeSystem.Telemetry.MaxFileSizeMB"),
+        MaxFileSizeMB,
+        TEXT("Size in megabytes after which the attribute telemetry capture rolls over to a new file."));
+
+    static int32 FlushIntervalMs = 250;
+    static FAutoConsoleVariableRef CVarFlushIntervalMs(
+        TEXT("AttributeSystem.Telemetry.FlushIntervalMs"),
+        FlushIntervalMs,
+        TEXT("Interval in milliseconds at which the telemetry writer thread drains the per-thread buffers."));
+
+    /** A thread buffer reaching this size wakes the writer early. */
+    static constexpr int32 WakeThreshold = 4096;
+
+    static const TCHAR* SourceToString(uint8 Source)
+    {
+        switch (static_cast<EAttributeChangeSource>(Source))
+        {
+        case EAttributeChangeSource::Initialize:      return TEXT("Initialize");
+        case EAttributeChangeSource::Set:             return TEXT("Set");
+        case EAttributeChangeSource::MinValue:        return TEXT("MinValue");
+        case EAttributeChangeSource::MaxValue:        return TEXT("MaxValue");
+        case EAttributeChangeSource::Modifier:        return TEXT("Modifier");
+        case EAttributeChangeSource::ModifierRemoved: return TEXT("ModifierRemoved");
+        case EAttributeChangeSource::Regen:           return TEXT("Regen");
+        case EAttributeChangeSource::Reset:           return TEXT("Reset");
+        case EAttributeChangeSource::LoadFromSave:    return TEXT("LoadFromSave");
+        case EAttributeChangeSource::RestoreDormant:  return TEXT("RestoreDormant");
+        case EAttributeChangeSource::Consume:         return TEXT("Consume");
+        default:                                      return TEXT("Unknown");
+        }
+    }
+}
+
+class FAttributeTelemetryRecorder::FWriterRunnable : public FRunnable
+{
+public:
+    explicit FWriterRunnable(FAttributeTelemetryRecorder& InRecorder)
+        : Recorder(InRecorder)
+    {}
+
+    virtual uint32 Run() override
+    {
+        Recorder.RunWriter();
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        Recorder.bStopRequested = true;
+        Recorder.WakeEvent->Trigger();
+    }
+
+private:
+    FAttributeTelemetryRecorder& Recorder;
+};
+
+std::atomic<bool> FAttributeTelemetryRecorder::bRecording(false);
+
+FAttributeTelemetryRecorder& FAttributeTelemetryRecorder::Get()
+{
+    static FAttributeTelemetryRecorder Instance;
+    return Instance;
+}
+
+FAttributeTelemetryRecorder::FAttributeTelemetryRecorder()
+    : bStopRequested(false), Thread(nullptr), WakeEvent(nullptr), FileWriter(nullptr), FileIndex(0), WrittenTagCount(0), WrittenActorCount(0), StartCycles(0)
+{
+    // Actor id 0 is reserved so components can use it as "not registered yet"
+    ActorNames.Add(TEXT("None"));
+}
+
+FAttributeTelemetryRecorder::~FAttributeTelemetryRecorder()
+{
+    // The wake event is intentionally not returned: the event pool may already be gone during static destruction
+    Stop();
+}
+
+bool FAttributeTelemetryRecorder::Start(const FString& InDirectory)
+{
+    if (IsRecording())
+    {
+        return true;
+    }
+
+    Directory = InDirectory.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("Telemetry") : InDirectory;
+    BaseFileName = FString::Printf(TEXT("AttributeTelemetry_%s"), *FDateTime::Now().ToString());
+    FileIndex = 0;
+    StartCycles = FPlatformTime::Cycles64();
+
+    if (!OpenNextFile())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::Start - Failed to open capture file in %s"), *Directory);
+        return false;
+    }
+
+    if (!WakeEvent)
+    {
+        // Kept for the lifetime of the recorder so late Record calls never see a dangling event
+        WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    }
+
+    bStopRequested = false;
+    Writer = MakeUnique<FWriterRunnable>(*this);
+    Thread = FRunnableThread::Create(Writer.Get(), TEXT("AttributeTelemetryWriter"), 0, TPri_BelowNormal);
+    bRecording = true;
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::Start - Recording to %s"), *(Directory / BaseFileName));
+    return true;
+}
+
+void FAttributeTelemetryRecorder::Stop()
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    bRecording = false;
+
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+    Writer.Reset();
+
+    CloseFile();
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::Stop - Recording stopped"));
+}
+
+uint32 FAttributeTelemetryRecorder::RegisterActor(const FString& ActorName)
+{
+    FScopeLock Lock(&ActorLock);
+    return static_cast<uint32>(ActorNames.Add(ActorName));
+}
+
+FAttributeTelemetryRecorder::FThreadBuffer& FAttributeTelemetryRecorder::GetThreadBuffer()
+{
+    static thread_local TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe> TlsBuffer;
+
+    if (!TlsBuffer.IsValid())
+    {
+        LLM_SCOPE_BYTAG(AttributeSystem);
+
+        TlsBuffer = MakeShared<FThreadBuffer, ESPMode::ThreadSafe>();
+        TlsBuffer->Records.Reserve(AttributeTelemetry::WakeThreshold);
+
+        FScopeLock Lock(&BuffersLock);
+        ThreadBuffers.Add(TlsBuffer);
+    }
+
+    return *TlsBuffer;
+}
+
+void FAttributeTelemetryRecorder::Record(uint32 ActorId, FAttributeId AttributeId, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source)
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    FAttributeTelemetryRecord NewRecord;
+    NewRecord.Cycles = FPlatformTime::Cycles64();
+    NewRecord.ActorId = ActorId;
+    NewRecord.TagId = AttributeId.GetIndex();
+    NewRecord.Operation = static_cast<uint8>(Operation);
+    NewRecord.Source = static_cast<uint8>(Source);
+    NewRecord.OldValue = OldValue;
+    NewRecord.NewValue = NewValue;
+
+    FThreadBuffer& Buffer = GetThreadBuffer();
+    int32 NumRecords;
+    {
+        FScopeLock Lock(&Buffer.Lock);
+        NumRecords = Buffer.Records.Add(NewRecord) + 1;
+    }
+
+    if (NumRecords == AttributeTelemetry::WakeThreshold)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FAttributeTelemetryRecorder::RunWriter()
+{
+    while (!bStopRequested)
+    {
+        WakeEvent->Wait(FMath::Max(AttributeTelemetry::FlushIntervalMs, 1));
+        FlushBuffers();
+    }
+
+    FlushBuffers();
+}
+
+void FAttributeTelemetryRecorder::FlushBuffers()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_TelemetryFlush);
+    LLM_SCOPE_BYTAG(AttributeSystem);
+
+    TArray<TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe>> Buffers;
+    {
+        FScopeLock Lock(&BuffersLock);
+        Buffers = ThreadBuffers;
+    }
+
+    TArray<FAttributeTelemetryRecord> Scratch;
+    for (const TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe>& Buffer : Buffers)
+    {
+        {
+            FScopeLock Lock(&Buffer->Lock);
+            Swap(Scratch, Buffer->Records);
+            Buffer->Records.Reserve(AttributeTelemetry::WakeThreshold);
+        }
+        PendingRecords.Append(Scratch);
+        Scratch.Reset();
+    }
+
+    {
+        // Drop buffers whose threads have exited; ours and the local copy are the only references left
+        FScopeLock Lock(&BuffersLock);
+        ThreadBuffers.RemoveAll([](const TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe>& Buffer)
+            {
+                return Buffer.GetSharedReferenceCount() <= 2 && Buffer->Records.Num() == 0;
+            });
+    }
+
+    if (!FileWriter || PendingRecords.Num() == 0)
+    {
+        return;
+    }
+
+    if (FileWriter->Tell() >= static_cast<int64>(AttributeTelemetry::MaxFileSizeMB) * 1024 * 1024)
+    {
+        CloseFile();
+        if (!OpenNextFile())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::FlushBuffers - Failed to roll capture file, dropping %d records"), PendingRecords.Num());
+            PendingRecords.Reset();
+            return;
+        }
+    }
+
+    // Names are written after the buffers were swapped, so every id referenced below is already defined
+    WriteNames();
+
+    uint8 BlockType = static_cast<uint8>(AttributeTelemetry::EBlockType::Records);
+    int32 NumRecords = PendingRecords.Num();
+    *FileWriter << BlockType;
+    *FileWriter << NumRecords;
+    FileWriter->Serialize(PendingRecords.GetData(), NumRecords * sizeof(FAttributeTelemetryRecord));
+    FileWriter->Flush();
+
+    PendingRecords.Reset();
+}
+
+bool FAttributeTelemetryRecorder::OpenNextFile()
+{
+    const FString FilePath = Directory / FString::Printf(TEXT("%s_%03d.bin"), *BaseFileName, FileIndex++);
+
+    IFileManager::Get().MakeDirectory(*Directory, true);
+    FileWriter = IFileManager::Get().CreateFileWriter(*FilePath);
+    if (!FileWriter)
+    {
+        return false;
+    }
+
+    uint32 Magic = AttributeTelemetry::FileMagic;
+    uint32 Version = AttributeTelemetry::FileVersion;
+    double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+    *FileWriter << Magic;
+    *FileWriter << Version;
+    *FileWriter << SecondsPerCycle;
+    *FileWriter << StartCycles;
+
+    // Every file is self-contained, so the name tables start over
+    WrittenTagCount = 0;
+    WrittenActorCount = 0;
+    return true;
+}
+
+void FAttributeTelemetryRecorder::CloseFile()
+{
+    if (FileWriter)
+    {
+        FileWriter->Close();
+        delete FileWriter;
+        FileWriter = nullptr;
+    }
+}
+
+void FAttributeTelemetryRecorder::WriteNames()
+{
+    const FAttributeRegistry& Registry = FAttributeRegistry::Get();
+    for (const int32 NumTags = Registry.Num(); WrittenTagCount < NumTags; ++WrittenTagCount)
+    {
+        uint8 BlockType = static_cast<uint8>(AttributeTelemetry::EBlockType::TagName);
+        uint16 TagId = static_cast<uint16>(WrittenTagCount);
+        FString TagName = Registry.GetTag(FAttributeId(TagId)).ToString();
+        *FileWriter << BlockType;
+        *FileWriter << TagId;
+        *FileWriter << TagName;
+    }
+
+    {
+        FScopeLock Lock(&ActorLock);
+        for (; WrittenActorCount < ActorNames.Num(); ++WrittenActorCount)
+        {
+            uint8 BlockType = static_cast<uint8>(AttributeTelemetry::EBlockType::ActorName);
+            uint32 ActorId = static_cast<uint32>(WrittenActorCount);
+            *FileWriter << BlockType;
+            *FileWriter << ActorId;
+            *FileWriter << ActorNames[WrittenActorCount];
+        }
+    }
+}
+
+bool FAttributeTelemetryRecorder::ConvertToCsv(const FString& InputPath, const FString& OutputPath)
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *InputPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - Failed to read %s"), *InputPath);
+        return false;
+    }
+
+    FMemoryReader Reader(Data);
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    double SecondsPerCycle = 0.0;
+    uint64 FileStartCycles = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << SecondsPerCycle;
+    Reader << FileStartCycles;
+
+    if (Magic != AttributeTelemetry::FileMagic || Version != AttributeTelemetry::FileVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - %s is not a supported telemetry capture"), *InputPath);
+        return false;
+    }
+
+    TUniquePtr<FArchive> CsvWriter(IFileManager::Get().CreateFileWriter(*OutputPath));
+    if (!CsvWriter)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - Failed to create %s"), *OutputPath);
+        return false;
+    }
+
+    auto WriteLine = [&CsvWriter](const FString& Line)
+        {
+            FTCHARToUTF8 Utf8(*Line);
+            CsvWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+            CsvWriter->Serialize(const_cast<ANSICHAR*>("\n"), 1);
+        };
+
+    WriteLine(TEXT("Time,Actor,Attribute,Operation,Source,OldValue,NewValue"));
+
+    const UEnum* OperationEnum = StaticEnum<EAttributeOperation>();
+    TMap<uint16, FString> Tags;
+    TMap<uint32, FString> Actors;
+    TArray<FAttributeTelemetryRecord> Records;
+    int64 NumWritten = 0;
+
+    while (!Reader.AtEnd() && !Reader.IsError())
+    {
+        uint8 BlockType = 0;
+        Reader << BlockType;
+
+        switch (static_cast<AttributeTelemetry::EBlockType>(BlockType))
+        {
+        case AttributeTelemetry::EBlockType::TagName:
+        {
+            uint16 TagId = 0;
+            FString Name;
+            Reader << TagId;
+            Reader << Name;
+            Tags.Add(TagId, MoveTemp(Name));
+            break;
+        }
+        case AttributeTelemetry::EBlockType::ActorName:
+        {
+            uint32 ActorId = 0;
+            FString Name;
+            Reader << ActorId;
+            Reader << Name;
+            Actors.Add(ActorId, MoveTemp(Name));
+            break;
+        }
+        case AttributeTelemetry::EBlockType::Records:
+        {
+            int32 NumRecords = 0;
+            Reader << NumRecords;
+            if (NumRecords < 0 || Reader.TotalSize() - Reader.Tell() < static_cast<int64>(NumRecords) * static_cast<int64>(sizeof(FAttributeTelemetryRecord)))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - Truncated record block in %s"), *InputPath);
+                Reader.SetError();
+                break;
+            }
+
+            Records.SetNumUninitialized(NumRecords);
+            Reader.Serialize(Records.GetData(), NumRecords * sizeof(FAttributeTelemetryRecord));
+
+            for (const FAttributeTelemetryRecord& Record : Records)
+            {
+                const FString* ActorName = Actors.Find(Record.ActorId);
+                const FString* TagName = Tags.Find(Record.TagId);
+                const double Time = (Record.Cycles - FileStartCycles) * SecondsPerCycle;
+
+                WriteLine(FString::Printf(TEXT("%.6f,%s,%s,%s,%s,%f,%f"),
+                    Time,
+                    ActorName ? **ActorName : TEXT("Unknown"),
+                    TagName ? **TagName : TEXT("Unknown"),
+                    OperationEnum ? *OperationEnum->GetNameStringByValue(Record.Operation) : *FString::FromInt(Record.Operation),
+                    AttributeTelemetry::SourceToString(Record.Source),
+                    Record.OldValue,
+                    Record.NewValue));
+            }
+            NumWritten += NumRecords;
+            break;
+        }
+        default:
+            UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - Unknown block type %d in %s"), BlockType, *InputPath);
+            Reader.SetError();
+            break;
+        }
+    }
+
+    CsvWriter->Close();
+
+    UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetry::ConvertToCsv - Wrote %lld records to %s"), NumWritten, *OutputPath);
+    return !Reader.IsError();
+}
+
+static FAutoConsoleCommand AttributeTelemetryStartCommand(
+    TEXT("AttributeSystem.Telemetry.Start"),
+    TEXT("Starts recording attribute changes. Optional argument: output directory."),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FAttributeTelemetryRecorder::Get().Start(Args.Num() > 0 ? Args[0] : FString());
+        }));
+
+static FAutoConsoleCommand AttributeTelemetryStopCommand(
+    TEXT("AttributeSystem.Telemetry.Stop"),
+    TEXT("Stops recording attribute changes and closes the capture file."),
+    FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FAttributeTelemetryRecorder::Get().Stop();
+        }));
+
+static FAutoConsoleCommand AttributeTelemetryToCsvCommand(
+    TEXT("AttributeSystem.Telemetry.ToCsv"),
+    TEXT("Converts an attribute telemetry capture to CSV. Arguments: <InputFile> [OutputFile]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() == 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Usage: AttributeSystem.Telemetry.ToCsv <InputFile> [OutputFile]"));
+                return;
+            }
+            FAttributeTelemetryRecorder::ConvertToCsv(Args[0], Args.Num() > 1 ? Args[1] : FPaths::ChangeExtension(Args[0], TEXT("csv")));
+        }));
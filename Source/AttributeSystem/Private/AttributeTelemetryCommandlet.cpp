@@ -0,0 +1,34 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeTelemetryCommandlet.h"
+#include "AttributeTelemetry.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeTelemetryCommandlet)
+
+UAttributeTelemetryCommandlet::UAttributeTelemetryCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UAttributeTelemetryCommandlet::Main(const FString& Params)
+{
+    FString InputPath;
+    if (!FParse::Value(*Params, TEXT("Input="), InputPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AttributeTelemetryCommandlet - Usage: -run=AttributeTelemetry -Input=<Capture.bin> [-Output=<Capture.csv>]"));
+        return 1;
+    }
+
+    FString OutputPath;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        OutputPath = FPaths::ChangeExtension(InputPath, TEXT("csv"));
+    }
+
+    return FAttributeTelemetryRecorder::ConvertToCsv(InputPath, OutputPath) ? 0 : 1;
+}
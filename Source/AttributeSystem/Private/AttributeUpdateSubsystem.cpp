@@ -0,0 +1,177 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeUpdateSubsystem.h"
+#include "AttributeComponent.h"
+#include "AttributeSystemStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "HAL/IConsoleManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeUpdateSubsystem)
+
+namespace AttributeUpdatePhase
+{
+    static bool bEnabled = false;
+    static FAutoConsoleVariableRef CVarEnabled(
+        TEXT("AttributeSystem.UpdatePhase.Enabled"),
+        bEnabled,
+        TEXT("Run regen, modifier expiry and threshold detection for components that begin play afterwards in a parallel update phase instead of per-component timers."));
+
+    static int32 ChunkSize = 64;
+    static FAutoConsoleVariableRef CVarChunkSize(
+        TEXT("AttributeSystem.UpdatePhase.ChunkSize"),
+        ChunkSize,
+        TEXT("Number of attribute components updated by one parallel task."));
+}
+
+void FAttributeUpdateTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+    {
+        Subsystem->RunUpdatePhase(DeltaTime);
+    }
+}
+
+FString FAttributeUpdateTickFunction::DiagnosticMessage()
+{
+    return TEXT("FAttributeUpdateTickFunction");
+}
+
+FName FAttributeUpdateTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return FName(TEXT("AttributeUpdatePhase"));
+}
+
+bool UAttributeUpdateSubsystem::IsEnabled()
+{
+    return AttributeUpdatePhase::bEnabled;
+}
+
+bool UAttributeUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAttributeUpdateSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    TickFunction.Subsystem = this;
+    TickFunction.bCanEverTick = true;
+    TickFunction.bStartWithTickEnabled = true;
+    TickFunction.TickGroup = TG_PrePhysics;
+    TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UAttributeUpdateSubsystem::Deinitialize()
+{
+    if (TickFunction.IsTickFunctionRegistered())
+    {
+        TickFunction.UnRegisterTickFunction();
+    }
+    TickFunction.Subsystem = nullptr;
+
+    Components.Empty();
+    ComponentIndices.Empty();
+    ChunkEvents.Empty();
+
+    Super::Deinitialize();
+}
+
+void UAttributeUpdateSubsystem::RegisterComponent(UAttributeComponent* Component)
+{
+    if (Component && !ComponentIndices.Contains(Component))
+    {
+        LLM_SCOPE_BYTAG(AttributeSystem);
+        ComponentIndices.Add(Component, Components.Add(Component));
+    }
+}
+
+void UAttributeUpdateSubsystem::UnregisterComponent(UAttributeComponent* Component)
+{
+    int32 Index;
+    if (!ComponentIndices.RemoveAndCopyValue(Component, Index))
+    {
+        return;
+    }
+
+    Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Components.IsValidIndex(Index))
+    {
+        ComponentIndices.FindChecked(Components[Index]) = Index;
+    }
+}
+
+void UAttributeUpdateSubsystem::RunUpdatePhase(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_UpdatePhase);
+
+    RemoveDestroyedComponents();
+    if (Components.Num() == 0)
+    {
+        return;
+    }
+
+    const int32 ChunkSize = FMath::Max(AttributeUpdatePhase::ChunkSize, 1);
+    const int32 NumChunks = FMath::DivideAndRoundUp(Components.Num(), ChunkSize);
+    if (ChunkEvents.Num() < NumChunks)
+    {
+        LLM_SCOPE_BYTAG(AttributeSystem);
+        ChunkEvents.SetNum(NumChunks);
+    }
+
+    const double CurrentTime = GetWorld()->GetTimeSeconds();
+    ParallelFor(NumChunks, [this, DeltaTime, CurrentTime, ChunkSize](int32 ChunkIndex)
+        {
+            LLM_SCOPE_BYTAG(AttributeSystem);
+
+            TArray<FAttributeUpdateEvent>& Events = ChunkEvents[ChunkIndex];
+            Events.Reset();
+
+            const int32 First = ChunkIndex * ChunkSize;
+            const int32 Last = FMath::Min(First + ChunkSize, Components.Num());
+            for (int32 Index = First; Index < Last; ++Index)
+            {
+                Components[Index]->UpdateAttributesParallel(DeltaTime, CurrentTime, Events);
+            }
+        });
+
+    DispatchEvents();
+}
+
+void UAttributeUpdateSubsystem::RemoveDestroyedComponents()
+{
+    // GC clears components that were destroyed without EndPlay; their raw keys in ComponentIndices are then stale
+    const int32 NumRemoved = Components.RemoveAll([](const TObjectPtr<UAttributeComponent>& Component) { return Component == nullptr; });
+    if (NumRemoved == 0)
+    {
+        return;
+    }
+
+    ComponentIndices.Reset();
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        ComponentIndices.Add(Components[Index], Index);
+    }
+}
+
+void UAttributeUpdateSubsystem::DispatchEvents()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_UpdatePhaseDispatch);
+
+    // Handlers may register or unregister components, but chunk lists are only rebuilt by the next update phase
+    for (TArray<FAttributeUpdateEvent>& Events : ChunkEvents)
+    {
+        for (const FAttributeUpdateEvent& Event : Events)
+        {
+            // The component may have ended play in a handler dispatched earlier this frame
+            if (IsValid(Event.Component) && ComponentIndices.Contains(Event.Component))
+            {
+                Event.Component->DispatchUpdateEvent(Event);
+            }
+        }
+        Events.Reset();
+    }
+}
@@ -0,0 +1,223 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+
+#include "AttributeViewModel.h"
+#include "AttributeComponent.h"
+#include "AttributeSystemStats.h"
+#include "Containers/Ticker.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AttributeViewModel)
+
+namespace
+{
+    /** Single core ticker shared by all view models, only registered while any of them is dirty. */
+    class FAttributeViewModelTicker
+    {
+    public:
+        static FAttributeViewModelTicker& Get()
+        {
+            static FAttributeViewModelTicker Instance;
+            return Instance;
+        }
+
+        void Enqueue(UAttributeViewModel* ViewModel)
+        {
+            Queued.Add(ViewModel);
+            if (!TickHandle.IsValid())
+            {
+                TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAttributeViewModelTicker::Tick));
+            }
+        }
+
+    private:
+        bool Tick(float DeltaTime)
+        {
+            SCOPE_CYCLE_COUNTER(STAT_AttributeSystem_ViewModelFlush);
+
+            const double CurrentTime = FPlatformTime::Seconds();
+            TArray<TWeakObjectPtr<UAttributeViewModel>> Flushing = MoveTemp(Queued);
+            for (const TWeakObjectPtr<UAttributeViewModel>& ViewModel : Flushing)
+            {
+                UAttributeViewModel* ViewModelPtr = ViewModel.Get();
+                if (ViewModelPtr && !ViewModelPtr->FlushQueued(CurrentTime))
+                {
+                    Queued.Add(ViewModel);
+                }
+            }
+
+            if (Queued.IsEmpty())
+            {
+                TickHandle.Reset();
+                return false;
+            }
+            return true;
+        }
+
+        TArray<TWeakObjectPtr<UAttributeViewModel>> Queued;
+        FTSTicker::FDelegateHandle TickHandle;
+    };
+}
+
+UAttributeViewModel* UAttributeViewModel::CreateAttributeViewModel(UObject* Owner, UAttributeComponent* Component, const TArray<FGameplayTag>& AttributeTags, float InUpdateInterval, float InEpsilon)
+{
+    UAttributeViewModel* ViewModel = NewObject<UAttributeViewModel>(Owner ? Owner : GetTransientPackage());
+    ViewModel->UpdateInterval = InUpdateInterval;
+    ViewModel->Epsilon = InEpsilon;
+    ViewModel->SetAttributes(AttributeTags);
+    ViewModel->SetComponent(Component);
+    return ViewModel;
+}
+
+void UAttributeViewModel::SetComponent(UAttributeComponent* InComponent)
+{
+    if (UAttributeComponent* OldComponent = Component.Get())
+    {
+        OldComponent->OnAttributeChanged.RemoveDynamic(this, &UAttributeViewModel::HandleAttributeChanged);
+        OldComponent->OnAttributesReady.RemoveDynamic(this, &UAttributeViewModel::ForceRefresh);
+    }
+
+    Component = InComponent;
+
+    if (InComponent)
+    {
+        InComponent->OnAttributeChanged.AddDynamic(this, &UAttributeViewModel::HandleAttributeChanged);
+        InComponent->OnAttributesReady.AddDynamic(this, &UAttributeViewModel::ForceRefresh);
+    }
+
+    ForceRefresh();
+}
+
+void UAttributeViewModel::SetAttributes(const TArray<FGameplayTag>& AttributeTags)
+{
+    Entries.Reset(AttributeTags.Num());
+    AttributeIds.Reset(AttributeTags.Num());
+
+    for (const FGameplayTag& AttributeTag : AttributeTags)
+    {
+        FAttributeViewEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.AttributeTag = AttributeTag;
+        AttributeIds.Add(FAttributeRegistry::Get().Register(AttributeTag));
+    }
+
+    // Without a ready component there is nothing to show yet; SetComponent and OnAttributesReady refresh later
+    if (Component.IsValid() && Component->AreAttributesReady())
+    {
+        ForceRefresh();
+    }
+}
+
+bool UAttributeViewModel::GetEntry(FGameplayTag AttributeTag, FAttributeViewEntry& OutEntry) const
+{
+    for (const FAttributeViewEntry& Entry : Entries)
+    {
+        if (Entry.AttributeTag == AttributeTag)
+        {
+            OutEntry = Entry;
+            return true;
+        }
+    }
+    OutEntry = FAttributeViewEntry();
+    return false;
+}
+
+float UAttributeViewModel::GetValue(FGameplayTag AttributeTag) const
+{
+    FAttributeViewEntry Entry;
+    GetEntry(AttributeTag, Entry);
+    return Entry.Value;
+}
+
+float UAttributeViewModel::GetNormalized(FGameplayTag AttributeTag) const
+{
+    FAttributeViewEntry Entry;
+    GetEntry(AttributeTag, Entry);
+    return Entry.Normalized;
+}
+
+void UAttributeViewModel::ForceRefresh()
+{
+    Refresh(true);
+}
+
+bool UAttributeViewModel::FlushQueued(double CurrentTime)
+{
+    if (UpdateInterval > 0.0f && LastFlushTime >= 0.0 && CurrentTime - LastFlushTime < UpdateInterval)
+    {
+        return false;
+    }
+
+    bQueued = false;
+    LastFlushTime = CurrentTime;
+    Refresh(false);
+    return true;
+}
+
+void UAttributeViewModel::BeginDestroy()
+{
+    if (UAttributeComponent* OldComponent = Component.Get())
+    {
+        OldComponent->OnAttributeChanged.RemoveDynamic(this, &UAttributeViewModel::HandleAttributeChanged);
+        OldComponent->OnAttributesReady.RemoveDynamic(this, &UAttributeViewModel::ForceRefresh);
+    }
+    Component.Reset();
+
+    Super::BeginDestroy();
+}
+
+void UAttributeViewModel::HandleAttributeChanged(FGameplayTag AttributeTag, float NewValue)
+{
+    if (bQueued)
+    {
+        return;
+    }
+
+    for (const FAttributeViewEntry& Entry : Entries)
+    {
+        if (Entry.AttributeTag == AttributeTag)
+        {
+            MarkDirty();
+            return;
+        }
+    }
+}
+
+void UAttributeViewModel::MarkDirty()
+{
+    bQueued = true;
+    FAttributeViewModelTicker::Get().Enqueue(this);
+}
+
+void UAttributeViewModel::Refresh(bool bForce)
+{
+    const UAttributeComponent* SourceComponent = Component.Get();
+    ChangedTags.Reset();
+
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        FAttributeViewEntry& Entry = Entries[Index];
+        const FAttribute* Attribute = SourceComponent ? SourceComponent->FindAttribute(AttributeIds[Index]) : nullptr;
+
+        const float Value = Attribute ? Attribute->Value : 0.0f;
+        const float MinValue = Attribute ? Attribute->MinValue : 0.0f;
+        const float MaxValue = Attribute ? Attribute->MaxValue : 0.0f;
+
+        const bool bReachedBound = Value != Entry.Value && (Value == MinValue || Value == MaxValue);
+        const bool bChanged = FMath::Abs(Value - Entry.Value) > Epsilon
+            || FMath::Abs(MinValue - Entry.MinValue) > Epsilon
+            || FMath::Abs(MaxValue - Entry.MaxValue) > Epsilon;
+
+        if (bForce || bChanged || bReachedBound)
+        {
+            Entry.Value = Value;
+            Entry.MinValue = MinValue;
+            Entry.MaxValue = MaxValue;
+            Entry.Normalized = MaxValue != MinValue ? (Value - MinValue) / (MaxValue - MinValue) : 0.0f;
+            ChangedTags.Add(Entry.AttributeTag);
+        }
+    }
+
+    if (ChangedTags.Num() > 0)
+    {
+        OnUpdated.Broadcast(this, ChangedTags);
+    }
+}
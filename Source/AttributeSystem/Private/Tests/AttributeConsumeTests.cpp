@@ -0,0 +1,78 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeTestListener.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeConsumeAtomicTest, "AttributeSystem.Consume.Atomic", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeConsumeAtomicTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 50.0f), MakeAttribute(AttributeTags::Mana, 30.0f) });
+    UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+    Component->OnAttributeChanged.AddDynamic(Listener, &UAttributeTestListener::HandleAttributeChanged);
+    Component->OnDeath.AddDynamic(Listener, &UAttributeTestListener::HandleDeath);
+
+    auto ExpectUnchanged = [this, Component, Listener](const TCHAR* What)
+        {
+            TestEqual(What, Component->GetAttributeValue(AttributeTags::Health), 50.0f);
+            TestEqual(What, Component->GetAttributeValue(AttributeTags::Mana), 30.0f);
+            TestEqual(What, Listener->NumAttributeChanges, 0);
+        };
+
+    const TArray<FAttributeCost> Unaffordable = { FAttributeCost(AttributeTags::Mana, 20.0f), FAttributeCost(AttributeTags::Health, 60.0f) };
+    TestFalse(TEXT("CanAfford rejects a cost one attribute cannot pay"), Component->CanAfford(Unaffordable));
+    TestFalse(TEXT("TryConsume rejects a cost one attribute cannot pay"), Component->TryConsume(Unaffordable));
+    ExpectUnchanged(TEXT("Nothing is paid when any cost fails"));
+
+    const TArray<FAttributeCost> Combined = { FAttributeCost(AttributeTags::Mana, 20.0f), FAttributeCost(AttributeTags::Mana, 15.0f) };
+    TestFalse(TEXT("Costs on the same attribute are summed"), Component->TryConsume(Combined));
+    ExpectUnchanged(TEXT("Nothing is paid when the summed cost fails"));
+
+    const TArray<FAttributeCost> Unknown = { FAttributeCost(AttributeTags::Mana, 1.0f), FAttributeCost(AttributeTags::Stamina, 1.0f) };
+    TestFalse(TEXT("Costs on missing attributes fail"), Component->TryConsume(Unknown));
+    ExpectUnchanged(TEXT("Nothing is paid when an attribute is missing"));
+
+    const TArray<FAttributeCost> Affordable = { FAttributeCost(AttributeTags::Mana, 30.0f), FAttributeCost(AttributeTags::Health, 10.0f) };
+    TestTrue(TEXT("Affordable costs are paid"), Component->TryConsume(Affordable));
+    TestEqual(TEXT("Mana can be paid down to its minimum"), Component->GetAttributeValue(AttributeTags::Mana), 0.0f);
+    TestEqual(TEXT("Health is paid"), Component->GetAttributeValue(AttributeTags::Health), 40.0f);
+    TestEqual(TEXT("Every paid attribute broadcasts once"), Listener->NumAttributeChanges, 2);
+    TestEqual(TEXT("Paying health above its minimum is not lethal"), Listener->NumDeaths, 0);
+
+    TestTrue(TEXT("Health can be paid down to its minimum"), Component->TryConsume({ FAttributeCost(AttributeTags::Health, 40.0f) }));
+    TestEqual(TEXT("Paying all health broadcasts OnDeath"), Listener->NumDeaths, 1);
+
+    FAttributeComponentTestAccess::BeginLoading(*Component);
+    TestFalse(TEXT("Nothing can be paid while attributes are loading"), Component->TryConsume({ FAttributeCost(AttributeTags::Mana, 0.0f) }));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeConsumeDeterministicTest, "AttributeSystem.Consume.Deterministic", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeConsumeDeterministicTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Mana, 0.3f, 0.0f, 1.0f) }, [](UAttributeComponent& InComponent)
+        {
+            InComponent.bDeterministic = true;
+        });
+
+    const int32 ChecksumBefore = Component->GetStateChecksum();
+    const TArray<FAttributeCost> Costs = { FAttributeCost(AttributeTags::Mana, 0.1f), FAttributeCost(AttributeTags::Mana, 0.2f) };
+    TestTrue(TEXT("Summed costs are paid in fixed point"), Component->TryConsume(Costs));
+    TestEqual(TEXT("Mana is paid down exactly"), Component->GetAttributeValue(AttributeTags::Mana), 0.0f, 0.0f);
+    TestFalse(TEXT("Nothing is left to pay afterwards"), Component->TryConsume({ FAttributeCost(AttributeTags::Mana, 0.1f) }));
+
+    Component->AdvanceSimulationTick();
+    TestNotEqual(TEXT("Paid costs are part of the state checksum"), Component->GetStateChecksum(), ChecksumBefore);
+    return true;
+}
+
+#endif
@@ -0,0 +1,84 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AttributeDeterminismTests
+{
+    UAttributeComponent* SpawnDeterministic(AttributeSystemTests::FTestWorld& World, const TArray<FAttribute>& Attributes)
+    {
+        return World.SpawnComponent(Attributes, [](UAttributeComponent& Component)
+            {
+                Component.bDeterministic = true;
+                Component.SimulationTickRate = 30;
+            });
+    }
+
+    void RunInputs(UAttributeComponent& Component, float Damage)
+    {
+        Component.SetAttributeValue(AttributeTags::Health, Damage, EAttributeOperation::Subtract);
+        Component.ApplyModifier(FAttributeModifier(AttributeTags::Mana, 0.1f, 0.5f));
+        Component.SetAttributeValue(AttributeTags::Mana, 1.0f / 3.0f, EAttributeOperation::Multiply);
+        for (int32 Tick = 0; Tick < 60; ++Tick)
+        {
+            Component.AdvanceSimulationTick();
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeDeterminismChecksumTest, "AttributeSystem.Determinism.Checksum", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeDeterminismChecksumTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+    using namespace AttributeDeterminismTests;
+
+    FTestWorld World;
+    const TArray<FAttribute> Attributes = { MakeRegenAttribute(AttributeTags::Health, 80.0f, 0.5f, 1.5f), MakeAttribute(AttributeTags::Mana, 33.3f) };
+    UAttributeComponent* First = SpawnDeterministic(World, Attributes);
+    UAttributeComponent* Second = SpawnDeterministic(World, Attributes);
+    UAttributeComponent* Diverged = SpawnDeterministic(World, Attributes);
+
+    RunInputs(*First, 12.25f);
+    RunInputs(*Second, 12.25f);
+    RunInputs(*Diverged, 12.5f);
+
+    TestEqual(TEXT("Simulation tick advances"), First->GetSimulationTick(), static_cast<int64>(60));
+    TestEqual(TEXT("Same inputs give the same checksum"), First->GetStateChecksum(), Second->GetStateChecksum());
+    TestEqual(TEXT("Same inputs give bit-identical values"), First->GetAttributeValue(AttributeTags::Health), Second->GetAttributeValue(AttributeTags::Health), 0.0f);
+    TestNotEqual(TEXT("Different inputs give a different checksum"), First->GetStateChecksum(), Diverged->GetStateChecksum());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeDeterminismRegenTest, "AttributeSystem.Determinism.Regen", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeDeterminismRegenTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+    using namespace AttributeDeterminismTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = SpawnDeterministic(World, { MakeRegenAttribute(AttributeTags::Health, 50.0f, 1.0f, 5.0f), MakeRegenAttribute(AttributeTags::Mana, 50.0f, 0.0f, 5.0f) });
+
+    for (int32 Tick = 0; Tick < 29; ++Tick)
+    {
+        Component->AdvanceSimulationTick();
+    }
+    TestEqual(TEXT("No regen before a full period"), Component->GetAttributeValue(AttributeTags::Health), 50.0f);
+
+    Component->AdvanceSimulationTick();
+    TestEqual(TEXT("Regen lands on the period tick"), Component->GetAttributeValue(AttributeTags::Health), 55.0f);
+    TestEqual(TEXT("RegenRate of zero never regenerates"), Component->GetAttributeValue(AttributeTags::Mana), 50.0f);
+
+    Component->ApplyModifier(FAttributeModifier(AttributeTags::Mana, 10.0f, 1.0f));
+    TestEqual(TEXT("Modifier applies immediately"), Component->GetAttributeValue(AttributeTags::Mana), 60.0f);
+    for (int32 Tick = 0; Tick < 30; ++Tick)
+    {
+        Component->AdvanceSimulationTick();
+    }
+    TestEqual(TEXT("Modifier expires after its duration in ticks"), Component->GetAttributeValue(AttributeTags::Mana), 50.0f);
+    return true;
+}
+
+#endif
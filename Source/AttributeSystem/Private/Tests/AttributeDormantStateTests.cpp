@@ -0,0 +1,91 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeDormantStateSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeDormantFastForwardTest, "AttributeSystem.Dormancy.FastForward", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeDormantFastForwardTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeDormantStateSubsystem* DormantSubsystem = World.Get()->GetSubsystem<UAttributeDormantStateSubsystem>();
+    if (!TestNotNull(TEXT("Dormant state subsystem exists in game worlds"), DormantSubsystem))
+    {
+        return false;
+    }
+
+    const FName StateId(TEXT("AttributeSystemTests_Dormant"));
+    const TArray<FAttribute> Attributes = { MakeRegenAttribute(AttributeTags::Mana, 10.0f, 1.0f, 5.0f), MakeAttribute(AttributeTags::Health, 50.0f) };
+    auto Configure = [StateId](UAttributeComponent& Component)
+        {
+            Component.DormantStateId = StateId;
+        };
+
+    UAttributeComponent* StreamedOut = World.SpawnComponent(Attributes, Configure);
+    StreamedOut->SetAttributeValue(AttributeTags::Mana, 20.0f, EAttributeOperation::Override);
+    StreamedOut->ApplyModifier(FAttributeModifier(AttributeTags::Health, 10.0f, 5.0f));
+    StreamedOut->ApplyModifier(FAttributeModifier(AttributeTags::Health, 5.0f, 1.0f));
+    StreamedOut->GetOwner()->RouteEndPlay(EEndPlayReason::RemovedFromWorld);
+    TestTrue(TEXT("State is captured when the owner is removed from the world"), DormantSubsystem->HasState(StateId));
+
+    // Quarter seconds stay exact in world time and below the engine's frame time clamp
+    World.Tick(0.25f, 12);
+
+    const TArray<uint8> Data = DormantSubsystem->SaveDormantStates();
+    DormantSubsystem->ClearStates();
+    TestTrue(TEXT("Saved states load back"), DormantSubsystem->LoadDormantStates(Data));
+    TestTrue(TEXT("Loaded state is keyed by the same id"), DormantSubsystem->HasState(StateId));
+
+    UAttributeComponent* StreamedIn = World.SpawnComponent(Attributes, Configure);
+    TestFalse(TEXT("State is taken on restore"), DormantSubsystem->HasState(StateId));
+    TestEqual(TEXT("Regen ticks elapsed while dormant are applied at once"), StreamedIn->GetAttributeValue(AttributeTags::Mana), 35.0f);
+    TestEqual(TEXT("Modifier that expired while dormant is gone, the other one is kept"), StreamedIn->GetAttributeValue(AttributeTags::Health), 60.0f);
+
+    World.Tick(0.25f, 9);
+    TestEqual(TEXT("Kept modifier expires after its remaining duration"), StreamedIn->GetAttributeValue(AttributeTags::Health), 50.0f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeDormantSerializeTest, "AttributeSystem.Dormancy.Serialize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeDormantSerializeTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeDormantStateSubsystem* DormantSubsystem = World.Get()->GetSubsystem<UAttributeDormantStateSubsystem>();
+    if (!TestNotNull(TEXT("Dormant state subsystem exists in game worlds"), DormantSubsystem))
+    {
+        return false;
+    }
+
+    const FAttributeId StaminaId = FAttributeId::FromTag(AttributeTags::Stamina);
+    FAttributeDormantState State;
+    State.Values.Add({ StaminaId, true, 12.0f, 0.0f, 40.0f });
+    State.Modifiers.Add({ StaminaId, 3.0f, -1.0f });
+    DormantSubsystem->StoreState(TEXT("Stored"), MoveTemp(State));
+
+    const TArray<uint8> Data = DormantSubsystem->SaveDormantStates();
+    DormantSubsystem->ClearStates();
+    TestTrue(TEXT("Saved states load back"), DormantSubsystem->LoadDormantStates(Data));
+
+    FAttributeDormantState Loaded;
+    double Elapsed = 0.0;
+    if (TestTrue(TEXT("State is stored under its id"), DormantSubsystem->TakeState(TEXT("Stored"), Loaded, Elapsed)))
+    {
+        TestTrue(TEXT("Values keep their attribute"), Loaded.Values.Num() == 1 && Loaded.Values[0].AttributeId == StaminaId && Loaded.Values[0].Value == 12.0f && Loaded.Values[0].MaxValue == 40.0f);
+        TestTrue(TEXT("Modifiers keep their attribute"), Loaded.Modifiers.Num() == 1 && Loaded.Modifiers[0].AttributeId == StaminaId && Loaded.Modifiers[0].RemainingTime < 0.0f);
+    }
+
+    TArray<uint8> Truncated = Data;
+    Truncated.SetNum(Truncated.Num() / 2);
+    TestFalse(TEXT("Truncated data is rejected"), DormantSubsystem->LoadDormantStates(Truncated));
+    TestEqual(TEXT("Rejected data leaves no partial states"), DormantSubsystem->GetNumStates(), 0);
+    return true;
+}
+
+#endif
@@ -0,0 +1,114 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeEffectSubsystem.h"
+#include "AttributeTestListener.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeEffectBatchingTest, "AttributeSystem.Effects.Batching", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeEffectBatchingTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeEffectSubsystem* EffectSubsystem = World.Get()->GetSubsystem<UAttributeEffectSubsystem>();
+    if (!TestNotNull(TEXT("Effect subsystem exists in game worlds"), EffectSubsystem))
+    {
+        return false;
+    }
+
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+    UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+    Component->OnAttributeChanged.AddDynamic(Listener, &UAttributeTestListener::HandleAttributeChanged);
+    Component->OnDeath.AddDynamic(Listener, &UAttributeTestListener::HandleDeath);
+
+    // Quarter seconds stay exact in world time and below the engine's frame time clamp
+    auto Advance = [&World, EffectSubsystem](int32 NumTicks)
+        {
+            for (int32 TickIndex = 0; TickIndex < NumTicks; ++TickIndex)
+            {
+                World.Tick(0.25f);
+                EffectSubsystem->Tick(0.25f);
+            }
+        };
+
+    FPeriodicAttributeEffect Timed;
+    Timed.AttributeTag = AttributeTags::Health;
+    Timed.Magnitude = -10.0f;
+    Timed.Period = 1.0f;
+    Timed.Duration = 2.5f;
+    EffectSubsystem->ApplyPeriodicEffect(Component, Timed);
+
+    FPeriodicAttributeEffect Endless = Timed;
+    Endless.Magnitude = -5.0f;
+    Endless.Duration = -1.0f;
+    const FPeriodicEffectHandle EndlessHandle = EffectSubsystem->ApplyPeriodicEffect(Component, Endless);
+    TestEqual(TEXT("Both effects run"), EffectSubsystem->GetNumActiveEffects(), 2);
+
+    Advance(3);
+    TestEqual(TEXT("Nothing ticks before the first period"), Component->GetAttributeValue(AttributeTags::Health), 100.0f);
+
+    Advance(1);
+    TestEqual(TEXT("Both effects tick once per period"), Component->GetAttributeValue(AttributeTags::Health), 85.0f);
+    TestEqual(TEXT("Effects due in the same frame are applied as one change"), Listener->NumAttributeChanges, 1);
+
+    Advance(8);
+    TestEqual(TEXT("Timed effect stops after its duration"), Component->GetAttributeValue(AttributeTags::Health), 65.0f);
+    TestEqual(TEXT("Expired effect is removed"), EffectSubsystem->GetNumActiveEffects(), 1);
+
+    TestTrue(TEXT("Effect can be removed by handle"), EffectSubsystem->RemovePeriodicEffect(EndlessHandle));
+    Advance(4);
+    TestEqual(TEXT("Removed effect no longer ticks"), Component->GetAttributeValue(AttributeTags::Health), 65.0f);
+    TestEqual(TEXT("Nothing died yet"), Listener->NumDeaths, 0);
+
+    FPeriodicAttributeEffect Lethal = Timed;
+    Lethal.Magnitude = -1000.0f;
+    EffectSubsystem->ApplyPeriodicEffect(Component, Lethal);
+    Advance(4);
+    TestEqual(TEXT("Lethal damage over time broadcasts OnDeath"), Listener->NumDeaths, 1);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeEffectStackingTest, "AttributeSystem.Effects.Stacking", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeEffectStackingTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeEffectSubsystem* EffectSubsystem = World.Get()->GetSubsystem<UAttributeEffectSubsystem>();
+    if (!TestNotNull(TEXT("Effect subsystem exists in game worlds"), EffectSubsystem))
+    {
+        return false;
+    }
+
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Mana, 0.0f) });
+
+    FPeriodicAttributeEffect Heal;
+    Heal.EffectTag = AttributeTags::Mana;
+    Heal.AttributeTag = AttributeTags::Mana;
+    Heal.Magnitude = 2.0f;
+    Heal.Period = 1.0f;
+    Heal.Stacking = EPeriodicEffectStacking::StackMagnitude;
+    Heal.MaxStacks = 2;
+
+    const FPeriodicEffectHandle Handle = EffectSubsystem->ApplyPeriodicEffect(Component, Heal);
+    EffectSubsystem->ApplyPeriodicEffect(Component, Heal);
+    EffectSubsystem->ApplyPeriodicEffect(Component, Heal);
+    TestEqual(TEXT("Stacks are capped at MaxStacks"), EffectSubsystem->GetStackCount(Handle), 2);
+    TestEqual(TEXT("Stacked applications share one effect"), EffectSubsystem->GetNumActiveEffects(), 1);
+
+    for (int32 TickIndex = 0; TickIndex < 4; ++TickIndex)
+    {
+        World.Tick(0.25f);
+        EffectSubsystem->Tick(0.25f);
+    }
+    TestEqual(TEXT("Magnitude scales with the stack count"), Component->GetAttributeValue(AttributeTags::Mana), 4.0f);
+
+    TestEqual(TEXT("Effects can be removed by tag"), EffectSubsystem->RemovePeriodicEffectsByTag(Component, AttributeTags::Mana), 1);
+    return true;
+}
+
+#endif
@@ -0,0 +1,94 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeTestListener.h"
+#include "NativeGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AttributeGroupTests
+{
+    // Kept outside Attribute.* so test-only tags never shift the frozen registry ids
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Root, "AttributeSystemTests");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Resist, "AttributeSystemTests.Resist");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(ResistFire, "AttributeSystemTests.Resist.Fire");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(ResistFrost, "AttributeSystemTests.Resist.Frost");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(ResistShock, "AttributeSystemTests.Resist.Shock");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(Armor, "AttributeSystemTests.Armor");
+
+    static TArray<FAttribute> MakeAttributes()
+    {
+        using namespace AttributeSystemTests;
+        return { MakeAttribute(ResistFire, 20.0f), MakeAttribute(AttributeTags::Health, 100.0f), MakeAttribute(ResistFrost, 40.0f), MakeAttribute(Armor, 10.0f) };
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeGroupQueryTest, "AttributeSystem.Groups.Query", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeGroupQueryTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+    using namespace AttributeGroupTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent(MakeAttributes());
+
+    TArray<FAttribute> Found = { MakeAttribute(AttributeTags::Mana, 1.0f) };
+    TestEqual(TEXT("Parent tag matches its children"), Component->GetAttributesInGroup(Resist, Found), 2);
+    if (TestEqual(TEXT("Output is replaced, not appended to"), Found.Num(), 2))
+    {
+        TestTrue(TEXT("Children are returned in data asset order"), Found[0].AttributeTag == ResistFire.GetTag());
+        TestTrue(TEXT("Children are returned in data asset order"), Found[1].AttributeTag == ResistFrost.GetTag());
+    }
+
+    TestEqual(TEXT("Grandparent tag matches every descendant"), Component->GetNumAttributesInGroup(Root), 3);
+    TestEqual(TEXT("Leaf tag matches itself"), Component->GetNumAttributesInGroup(ResistFire), 1);
+    TestEqual(TEXT("Unused tag matches nothing"), Component->GetNumAttributesInGroup(ResistShock), 0);
+    TestEqual(TEXT("Invalid tag matches nothing"), Component->GetNumAttributesInGroup(FGameplayTag()), 0);
+
+    float Total = 0.0f;
+    Component->ForEachAttributeInGroup(Resist, [&Total](const FAttribute& Attribute)
+        {
+            Total += Attribute.Value;
+        });
+    TestEqual(TEXT("Visitor sees every child"), Total, 60.0f);
+
+    Component->AddAttribute(MakeAttribute(ResistShock, 30.0f));
+    TestEqual(TEXT("Added attribute joins its group"), Component->GetNumAttributesInGroup(Resist), 3);
+
+    Component->RemoveAttribute(ResistFire);
+    TestEqual(TEXT("Removed attribute leaves its group"), Component->GetNumAttributesInGroup(Resist), 2);
+    TestEqual(TEXT("Removed attribute leaves every ancestor group"), Component->GetNumAttributesInGroup(Root), 3);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeGroupSetValueTest, "AttributeSystem.Groups.SetValue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeGroupSetValueTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+    using namespace AttributeGroupTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent(MakeAttributes());
+    UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+    Component->OnAttributeChanged.AddDynamic(Listener, &UAttributeTestListener::HandleAttributeChanged);
+
+    Component->SetGroupAttributeValue(Resist, 0.5f, EAttributeOperation::Multiply);
+    TestEqual(TEXT("Operation is applied to the first child"), Component->GetAttributeValue(ResistFire), 10.0f);
+    TestEqual(TEXT("Operation is applied to the second child"), Component->GetAttributeValue(ResistFrost), 20.0f);
+    TestEqual(TEXT("Attributes outside the group are untouched"), Component->GetAttributeValue(Armor), 10.0f);
+    TestEqual(TEXT("Each child broadcasts its own change"), Listener->NumAttributeChanges, 2);
+
+    FAttributeComponentTestAccess::BeginLoading(*Component);
+    Component->SetGroupAttributeValue(Root, 5.0f, EAttributeOperation::Add);
+    TestEqual(TEXT("Group write is queued as one operation while loading"), FAttributeComponentTestAccess::NumPendingOperations(*Component), 1);
+
+    Component->LoadAttributesFromDataAsset();
+    TestEqual(TEXT("Queued group write is resolved against the loaded attributes"), Component->GetAttributeValue(ResistFire), 25.0f);
+    TestEqual(TEXT("Queued group write reaches every descendant"), Component->GetAttributeValue(Armor), 15.0f);
+    TestEqual(TEXT("Queued group write skips attributes outside the group"), Component->GetAttributeValue(AttributeTags::Health), 100.0f);
+    return true;
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeSystemStats.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeInstrumentationTraceTest, "AttributeSystem.Instrumentation.TraceChannel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeInstrumentationTraceTest::RunTest(const FString& Parameters)
+{
+#if UE_TRACE_ENABLED
+    using namespace AttributeSystemTests;
+
+    const bool bWasEnabled = AttributeSystemChannel.IsEnabled();
+
+    TestTrue(TEXT("Channel is registered as AttributeSystem"), UE::Trace::ToggleChannel(TEXT("AttributeSystem"), true));
+    TestTrue(TEXT("Channel can be enabled"), AttributeSystemChannel.IsEnabled());
+
+    // Changes made while the channel is on go through the event path
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+    Component->SetAttributeValue(AttributeTags::Health, 40.0f, EAttributeOperation::Override);
+    TestEqual(TEXT("Traced change is applied"), Component->GetAttributeValue(AttributeTags::Health), 40.0f);
+
+    UE::Trace::ToggleChannel(TEXT("AttributeSystem"), false);
+    TestFalse(TEXT("Channel can be disabled"), AttributeSystemChannel.IsEnabled());
+
+    UE::Trace::ToggleChannel(TEXT("AttributeSystem"), bWasEnabled);
+#else
+    AddInfo(TEXT("Skipped: trace is compiled out"));
+#endif
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeInstrumentationStatsTest, "AttributeSystem.Instrumentation.Stats", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeInstrumentationStatsTest::RunTest(const FString& Parameters)
+{
+#if STATS
+    TestTrue(TEXT("Cycle stats are in the AttributeSystem group"), std::is_same_v<FStat_STAT_AttributeSystem_SetAttribute::TGroup, FStatGroup_STATGROUP_AttributeSystem>);
+    TestTrue(TEXT("Counters are in the AttributeSystem group"), std::is_same_v<FStat_STAT_AttributeSystem_NumComponents::TGroup, FStatGroup_STATGROUP_AttributeSystem>);
+    TestTrue(TEXT("Set Attribute is a cycle stat"), FStat_STAT_AttributeSystem_SetAttribute::IsCycleStat());
+    TestFalse(TEXT("Live Components accumulates instead of clearing every frame"), FStat_STAT_AttributeSystem_NumComponents::IsClearEveryFrame());
+    TestEqual(TEXT("Group shows up as AttributeSystem in stat commands"), FString(FStatGroup_STATGROUP_AttributeSystem::GetDescription()), FString(TEXT("AttributeSystem")));
+    TestTrue(TEXT("Group is enabled by default"), FStatGroup_STATGROUP_AttributeSystem::IsDefaultEnabled());
+#else
+    AddInfo(TEXT("Skipped: stats are compiled out"));
+#endif
+    return true;
+}
+
+#endif
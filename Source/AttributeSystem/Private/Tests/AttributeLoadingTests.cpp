@@ -0,0 +1,68 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "Kismet/GameplayStatics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeLoadingReplayOrderTest, "AttributeSystem.Loading.ReplayOrder", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeLoadingReplayOrderTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+    FAttributeComponentTestAccess::BeginLoading(*Component);
+
+    Component->SetAttributeValue(AttributeTags::Health, 50.0f, EAttributeOperation::Override);
+    Component->SetAttributeValue(AttributeTags::Health, 10.0f, EAttributeOperation::Add);
+    Component->AddAttribute(MakeAttribute(AttributeTags::Mana, 0.0f));
+    Component->SetAttributeValue(AttributeTags::Mana, 25.0f, EAttributeOperation::Override);
+    Component->RemoveAttribute(AttributeTags::Stamina);
+
+    TestEqual(TEXT("Every write is queued while loading"), FAttributeComponentTestAccess::NumPendingOperations(*Component), 5);
+    TestFalse(TEXT("Attributes are not ready while loading"), Component->AreAttributesReady());
+
+    Component->LoadAttributesFromDataAsset();
+
+    TestTrue(TEXT("Attributes are ready once loaded"), Component->AreAttributesReady());
+    TestEqual(TEXT("Queue is drained on ready"), FAttributeComponentTestAccess::NumPendingOperations(*Component), 0);
+    TestEqual(TEXT("Override is replayed before the add"), Component->GetAttributeValue(AttributeTags::Health), 60.0f);
+    TestTrue(TEXT("Queued attribute is added"), Component->IsValidAttribute(AttributeTags::Mana));
+    TestEqual(TEXT("Write to a queued attribute lands after it is added"), Component->GetAttributeValue(AttributeTags::Mana), 25.0f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeLoadingSaveSlotTest, "AttributeSystem.Loading.SaveSlot", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeLoadingSaveSlotTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    const FString SlotName = TEXT("AttributeSystemTests_Loading");
+    const FString EmptySlotName = TEXT("AttributeSystemTests_LoadingEmpty");
+    UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+    UGameplayStatics::DeleteGameInSlot(EmptySlotName, 0);
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+    Component->SetAttributeValue(AttributeTags::Health, 30.0f, EAttributeOperation::Override);
+    Component->SaveAttributes(SlotName, 0);
+
+    FAttributeComponentTestAccess::BeginLoading(*Component);
+    Component->SaveAttributes(EmptySlotName, 0);
+    TestFalse(TEXT("Saving while loading does not write a slot"), UGameplayStatics::DoesSaveGameExist(EmptySlotName, 0));
+
+    Component->SetAttributeValue(AttributeTags::Health, 80.0f, EAttributeOperation::Override);
+    Component->LoadAttributes(SlotName, 0);
+    Component->SetAttributeValue(AttributeTags::Health, 5.0f, EAttributeOperation::Add);
+    Component->LoadAttributesFromDataAsset();
+
+    TestEqual(TEXT("Slot load is replayed in call order"), Component->GetAttributeValue(AttributeTags::Health), 35.0f);
+
+    UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+    return true;
+}
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeQuerySubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeQueryBucketBoundaryTest, "AttributeSystem.Query.BucketBoundaries", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeQueryBucketBoundaryTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeQuerySubsystem* QuerySubsystem = World.Get()->GetSubsystem<UAttributeQuerySubsystem>();
+    if (!TestNotNull(TEXT("Query subsystem exists in game worlds"), QuerySubsystem))
+    {
+        return false;
+    }
+
+    // 0.5 and 0.75 fall exactly on bucket edges, 1.0 is clamped into the last bucket
+    UAttributeComponent* Below = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 49.0f) });
+    UAttributeComponent* AtMin = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 50.0f) });
+    UAttributeComponent* Inside = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 51.0f) });
+    UAttributeComponent* AtMax = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 75.0f) });
+    UAttributeComponent* Full = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+
+    TArray<UAttributeComponent*> Result;
+    QuerySubsystem->QueryInRange(AttributeTags::Health, 0.5f, 0.75f, FVector::ZeroVector, 0.0f, Result);
+    TestEqual(TEXT("Range is inclusive on both edges"), Result.Num(), 3);
+    TestTrue(TEXT("Lower edge is included"), Result.Contains(AtMin));
+    TestTrue(TEXT("Inner value is included"), Result.Contains(Inside));
+    TestTrue(TEXT("Upper edge is included"), Result.Contains(AtMax));
+    TestFalse(TEXT("Value below the lower edge is excluded"), Result.Contains(Below));
+    TestEqual(TEXT("CountInRange agrees with QueryInRange"), QuerySubsystem->CountInRange(AttributeTags::Health, 0.5f, 0.75f, FVector::ZeroVector, 0.0f), 3);
+
+    QuerySubsystem->QueryInRange(AttributeTags::Health, 0.9f, 1.0f, FVector::ZeroVector, 0.0f, Result);
+    TestTrue(TEXT("Full value lands in the last bucket"), Result.Num() == 1 && Result[0] == Full);
+
+    QuerySubsystem->FindLowest(AttributeTags::Health, 2, FVector::ZeroVector, 0.0f, Result);
+    TestTrue(TEXT("FindLowest orders ascending across buckets"), Result.Num() == 2 && Result[0] == Below && Result[1] == AtMin);
+
+    Inside->SetAttributeValue(AttributeTags::Health, 90.0f, EAttributeOperation::Override);
+    TestEqual(TEXT("Index follows value changes across buckets"), QuerySubsystem->CountInRange(AttributeTags::Health, 0.5f, 0.75f, FVector::ZeroVector, 0.0f), 2);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeQueryResyncTest, "AttributeSystem.Query.Resync", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeQueryResyncTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeQuerySubsystem* QuerySubsystem = World.Get()->GetSubsystem<UAttributeQuerySubsystem>();
+    if (!TestNotNull(TEXT("Query subsystem exists in game worlds"), QuerySubsystem))
+    {
+        return false;
+    }
+
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 50.0f), MakeAttribute(AttributeTags::Mana, 20.0f) });
+    Component->AddAttribute(MakeAttribute(AttributeTags::Stamina, 10.0f));
+
+    TArray<UAttributeComponent*> Result;
+    QuerySubsystem->QueryInRange(AttributeTags::Health, 0.0f, 1.0f, FVector::ZeroVector, 0.0f, Result);
+    TestEqual(TEXT("Resync after AddAttribute indexes the component once"), Result.Num(), 1);
+    TestEqual(TEXT("Added attribute is indexed"), QuerySubsystem->CountInRange(AttributeTags::Stamina, 0.0f, 1.0f, FVector::ZeroVector, 0.0f), 1);
+
+    Component->RemoveAttribute(AttributeTags::Mana);
+    TestEqual(TEXT("Removed attribute leaves the index"), QuerySubsystem->CountInRange(AttributeTags::Mana, 0.0f, 1.0f, FVector::ZeroVector, 0.0f), 0);
+    TestEqual(TEXT("Other attributes stay indexed"), QuerySubsystem->CountInRange(AttributeTags::Health, 0.0f, 1.0f, FVector::ZeroVector, 0.0f), 1);
+
+    QuerySubsystem->RemoveComponent(Component);
+    TestEqual(TEXT("RemoveComponent clears every attribute of the component"), QuerySubsystem->CountInRange(AttributeTags::Health, 0.0f, 1.0f, FVector::ZeroVector, 0.0f) + QuerySubsystem->CountInRange(AttributeTags::Stamina, 0.0f, 1.0f, FVector::ZeroVector, 0.0f), 0);
+    return true;
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeRegistry.h"
+#include "AttributeSaveGame.h"
+#include "Kismet/GameplayStatics.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeRegistryStableIdTest, "AttributeSystem.Registry.StableIds", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeRegistryStableIdTest::RunTest(const FString& Parameters)
+{
+    const FAttributeId HealthId = FAttributeId::FromTag(AttributeTags::Health);
+    const FAttributeId ManaId = FAttributeId::FromTag(AttributeTags::Mana);
+    const FAttributeId StaminaId = FAttributeId::FromTag(AttributeTags::Stamina);
+
+    FAttributeRegistry& Registry = FAttributeRegistry::Get();
+    TestTrue(TEXT("Native attribute tags get frozen ids"), Registry.IsStable(HealthId) && Registry.IsStable(ManaId) && Registry.IsStable(StaminaId));
+    TestTrue(TEXT("Frozen ids follow lexical tag order"), HealthId.GetIndex() < ManaId.GetIndex() && ManaId.GetIndex() < StaminaId.GetIndex());
+    TestEqual(TEXT("Ids map back to their tag"), HealthId.GetTag(), AttributeTags::Health.GetTag());
+    TestFalse(TEXT("Unknown tags have no id"), FAttributeId::FromTag(FGameplayTag()).IsValid());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeRegistryNetSerializeTest, "AttributeSystem.Registry.NetSerialize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeRegistryNetSerializeTest::RunTest(const FString& Parameters)
+{
+    FAttributeId ManaId = FAttributeId::FromTag(AttributeTags::Mana);
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    bool bSuccess = false;
+    ManaId.NetSerialize(Writer, nullptr, bSuccess);
+    TestTrue(TEXT("Serialized"), bSuccess);
+    TestEqual(TEXT("Stable ids replicate as their index only"), Bytes.Num(), static_cast<int32>(sizeof(uint16)));
+
+    FAttributeId ReadId;
+    FMemoryReader Reader(Bytes);
+    ReadId.NetSerialize(Reader, nullptr, bSuccess);
+    TestEqual(TEXT("Round trip keeps the id"), ReadId, ManaId);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeRegistrySaveRemapTest, "AttributeSystem.Registry.SaveRemap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeRegistrySaveRemapTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    const FString SlotName = TEXT("AttributeSystemTests_Remap");
+    const FAttributeId HealthId = FAttributeId::FromTag(AttributeTags::Health);
+    const FAttributeId ManaId = FAttributeId::FromTag(AttributeTags::Mana);
+
+    // Written by a build where the ids of Health and Mana were swapped
+    UAttributeSaveGame* SaveGame = Cast<UAttributeSaveGame>(UGameplayStatics::CreateSaveGameObject(UAttributeSaveGame::StaticClass()));
+    SaveGame->SavedIds = { ManaId.GetIndex(), HealthId.GetIndex() };
+    SaveGame->SavedTags = { AttributeTags::Health, AttributeTags::Mana };
+    SaveGame->SavedValues = { 42.0f, 7.0f };
+    UGameplayStatics::SaveGameToSlot(SaveGame, SlotName, 0);
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f), MakeAttribute(AttributeTags::Mana, 100.0f) });
+    Component->LoadAttributes(SlotName, 0);
+
+    TestEqual(TEXT("Health is remapped through its saved tag"), Component->GetAttributeValue(AttributeTags::Health), 42.0f);
+    TestEqual(TEXT("Mana is remapped through its saved tag"), Component->GetAttributeValue(AttributeTags::Mana), 7.0f);
+
+    Component->SetAttributeValue(AttributeTags::Mana, 12.0f, EAttributeOperation::Override);
+    Component->SaveAttributes(SlotName, 0);
+    const UAttributeSaveGame* Saved = Cast<UAttributeSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+    if (TestNotNull(TEXT("Slot was written"), Saved))
+    {
+        TestEqual(TEXT("Only the component's own attributes are saved"), Saved->SavedTags.Num(), 2);
+        const int32 ManaIndex = Saved->SavedTags.IndexOfByKey(AttributeTags::Mana.GetTag());
+        TestTrue(TEXT("Saved id matches its tag"), ManaIndex != INDEX_NONE && Saved->SavedIds[ManaIndex] == ManaId.GetIndex() && Saved->SavedValues[ManaIndex] == 12.0f);
+    }
+
+    UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+    return true;
+}
+
+#endif
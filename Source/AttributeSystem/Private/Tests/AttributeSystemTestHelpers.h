@@ -0,0 +1,111 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AttributeComponent.h"
+#include "AttributeData.h"
+#include "AttributeGameplayTags.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+
+struct FAttributeComponentTestAccess
+{
+    // Puts a ready component back into the state it is in while its data asset streams in
+    static void BeginLoading(UAttributeComponent& Component)
+    {
+        Component.bAttributesReady = false;
+        Component.bAttributesLoading = true;
+    }
+
+    static int32 NumPendingOperations(const UAttributeComponent& Component)
+    {
+        return Component.PendingOperations.Num();
+    }
+};
+
+namespace AttributeSystemTests
+{
+    inline FAttribute MakeAttribute(const FGameplayTag& AttributeTag, float Value, float MinValue = 0.0f, float MaxValue = 100.0f)
+    {
+        return FAttribute(AttributeTag, Value, MinValue, MaxValue);
+    }
+
+    inline FAttribute MakeRegenAttribute(const FGameplayTag& AttributeTag, float Value, float RegenRate, float RegenValue, float MinValue = 0.0f, float MaxValue = 100.0f)
+    {
+        return FAttribute(AttributeTag, Value, MinValue, MaxValue, true, RegenRate, RegenValue);
+    }
+
+    // Game world ticked by hand; its actors and the world itself are destroyed when it goes out of scope
+    class FTestWorld
+    {
+    public:
+        FTestWorld()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false);
+            FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+            WorldContext.SetCurrentWorld(World);
+            World->InitializeActorsForPlay(FURL());
+            World->BeginPlay();
+        }
+
+        ~FTestWorld()
+        {
+            for (AActor* Actor : Actors)
+            {
+                if (IsValid(Actor))
+                {
+                    Actor->Destroy();
+                }
+            }
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+        }
+
+        UWorld* Get() const { return World; }
+
+        void Tick(float DeltaSeconds, int32 NumTicks = 1)
+        {
+            for (int32 TickIndex = 0; TickIndex < NumTicks; ++TickIndex)
+            {
+                World->Tick(LEVELTICK_All, DeltaSeconds);
+            }
+        }
+
+        // Spawns an actor owning a component initialized from Attributes; Configure runs before BeginPlay
+        UAttributeComponent* SpawnComponent(const TArray<FAttribute>& Attributes, TFunction<void(UAttributeComponent&)> Configure = nullptr)
+        {
+            AActor* Actor = World->SpawnActor<AActor>();
+            Actors.Add(Actor);
+
+            UAttributeData* AttributeData = NewObject<UAttributeData>(GetTransientPackage());
+            AttributeData->Attributes = Attributes;
+
+            UAttributeComponent* Component = NewObject<UAttributeComponent>(Actor);
+            Component->AttributeDataAsset = AttributeData;
+            if (Configure)
+            {
+                Configure(*Component);
+            }
+            Actor->AddInstanceComponent(Component);
+            Component->RegisterComponent();
+
+            if (!Actor->HasActorBegunPlay())
+            {
+                Actor->DispatchBeginPlay();
+            }
+            return Component;
+        }
+
+    private:
+        UWorld* World;
+        TArray<AActor*> Actors;
+    };
+}
+
+#endif
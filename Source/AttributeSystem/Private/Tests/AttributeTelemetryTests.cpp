@@ -0,0 +1,96 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeTelemetry.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeTelemetryCaptureTest, "AttributeSystem.Telemetry.Capture", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeTelemetryCaptureTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FAttributeTelemetryRecorder& Recorder = FAttributeTelemetryRecorder::Get();
+    if (FAttributeTelemetryRecorder::IsRecording())
+    {
+        AddInfo(TEXT("Skipped: a telemetry capture is already running"));
+        return true;
+    }
+
+    const FString Directory = FPaths::AutomationTransientDir() / TEXT("AttributeTelemetry");
+    IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 100.0f) });
+
+    if (!TestTrue(TEXT("Recorder starts"), Recorder.Start(Directory)))
+    {
+        return false;
+    }
+    Component->SetAttributeValue(AttributeTags::Health, 40.0f, EAttributeOperation::Override);
+    Recorder.Stop();
+    TestFalse(TEXT("Recorder stops"), FAttributeTelemetryRecorder::IsRecording());
+
+    TArray<FString> Captures;
+    IFileManager::Get().FindFiles(Captures, *(Directory / TEXT("*.bin")), true, false);
+    if (!TestEqual(TEXT("One capture file is written"), Captures.Num(), 1))
+    {
+        return false;
+    }
+
+    const FString CsvPath = Directory / TEXT("Capture.csv");
+    TestTrue(TEXT("Capture converts to CSV"), FAttributeTelemetryRecorder::ConvertToCsv(Directory / Captures[0], CsvPath));
+
+    TArray<FString> Lines;
+    FFileHelper::LoadFileToStringArray(Lines, *CsvPath);
+    if (!TestEqual(TEXT("Header and the recorded change are written"), Lines.Num(), 2))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Header"), Lines[0], FString(TEXT("Time,Actor,Attribute,Operation,Source,OldValue,NewValue")));
+
+    TArray<FString> Columns;
+    Lines[1].ParseIntoArray(Columns, TEXT(","), false);
+    if (!TestEqual(TEXT("Record has every column"), Columns.Num(), 7))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Actor name is resolved"), Columns[1], Component->GetOwner()->GetName());
+    TestEqual(TEXT("Attribute tag is resolved"), Columns[2], AttributeTags::Health.GetTag().ToString());
+    TestEqual(TEXT("Operation"), Columns[3], FString(TEXT("Override")));
+    TestEqual(TEXT("Source"), Columns[4], FString(TEXT("Set")));
+    TestEqual(TEXT("Old value"), FCString::Atof(*Columns[5]), 100.0f);
+    TestEqual(TEXT("New value"), FCString::Atof(*Columns[6]), 40.0f);
+
+    Component->SetAttributeValue(AttributeTags::Health, 20.0f, EAttributeOperation::Override);
+    TArray<FString> CapturesAfterStop;
+    IFileManager::Get().FindFiles(CapturesAfterStop, *(Directory / TEXT("*.bin")), true, false);
+    TestEqual(TEXT("Changes after Stop do not open a new capture"), CapturesAfterStop.Num(), 1);
+
+    IFileManager::Get().DeleteDirectory(*Directory, false, true);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeTelemetryInvalidCaptureTest, "AttributeSystem.Telemetry.InvalidCapture", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeTelemetryInvalidCaptureTest::RunTest(const FString& Parameters)
+{
+    const FString Directory = FPaths::AutomationTransientDir() / TEXT("AttributeTelemetry");
+    const FString InputPath = Directory / TEXT("Invalid.bin");
+    const FString CsvPath = Directory / TEXT("Invalid.csv");
+
+    FFileHelper::SaveStringToFile(TEXT("not a capture"), *InputPath);
+
+    AddExpectedError(TEXT("is not a supported telemetry capture"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestFalse(TEXT("Files without the capture header are rejected"), FAttributeTelemetryRecorder::ConvertToCsv(InputPath, CsvPath));
+    TestFalse(TEXT("No CSV is written for a rejected capture"), IFileManager::Get().FileExists(*CsvPath));
+
+    IFileManager::Get().DeleteDirectory(*Directory, false, true);
+    return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+#include "AttributeTestListener.generated.h"
+
+class UAttributeViewModel;
+
+/** Counts dynamic delegate broadcasts for the automation tests. */
+UCLASS(Transient)
+class UAttributeTestListener : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION()
+    void HandleAttributeChanged(FGameplayTag AttributeTag, float NewValue)
+    {
+        ++NumAttributeChanges;
+    }
+
+    UFUNCTION()
+    void HandleThresholdReached(FGameplayTag AttributeTag, float CurrentValue)
+    {
+        ++NumThresholdsReached;
+    }
+
+    UFUNCTION()
+    void HandleDeath()
+    {
+        ++NumDeaths;
+    }
+
+    UFUNCTION()
+    void HandleViewUpdated(UAttributeViewModel* ViewModel, const TArray<FGameplayTag>& ChangedTags)
+    {
+        ++NumViewUpdates;
+        LastChangedTags = ChangedTags;
+    }
+
+    int32 NumAttributeChanges = 0;
+    int32 NumThresholdsReached = 0;
+    int32 NumDeaths = 0;
+    int32 NumViewUpdates = 0;
+    TArray<FGameplayTag> LastChangedTags;
+};
@@ -0,0 +1,64 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeTestListener.h"
+#include "AttributeUpdateSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeUpdatePhaseTest, "AttributeSystem.UpdatePhase.ParallelRegen", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeUpdatePhaseTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    IConsoleVariable* EnabledVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("AttributeSystem.UpdatePhase.Enabled"));
+    IConsoleVariable* ChunkSizeVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("AttributeSystem.UpdatePhase.ChunkSize"));
+    if (!TestNotNull(TEXT("Update phase console variables exist"), EnabledVariable) || !TestNotNull(TEXT("Chunk size console variable exists"), ChunkSizeVariable))
+    {
+        return false;
+    }
+
+    const bool bWasEnabled = EnabledVariable->GetBool();
+    const int32 OldChunkSize = ChunkSizeVariable->GetInt();
+    EnabledVariable->Set(true, ECVF_SetByCode);
+    ChunkSizeVariable->Set(16, ECVF_SetByCode);
+
+    {
+        FTestWorld World;
+        UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+
+        // Enough components for several chunks, all regenerating on the same schedule
+        TArray<UAttributeComponent*> Components;
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            UAttributeComponent* Component = World.SpawnComponent({
+                MakeRegenAttribute(AttributeTags::Mana, 10.0f, 0.5f, 2.0f),
+                MakeRegenAttribute(AttributeTags::Stamina, 1.0f, 0.5f, -1.0f),
+                MakeAttribute(AttributeTags::Health, 50.0f) });
+            Component->OnAttributeThresholdReached.AddDynamic(Listener, &UAttributeTestListener::HandleThresholdReached);
+            Components.Add(Component);
+        }
+        Components[0]->ApplyModifier(FAttributeModifier(AttributeTags::Health, 10.0f, 0.5f));
+        TestEqual(TEXT("Modifier applies immediately"), Components[0]->GetAttributeValue(AttributeTags::Health), 60.0f);
+
+        // Quarter seconds stay exact in world time and below the engine's frame time clamp
+        World.Tick(0.25f, 4);
+
+        int32 NumMatching = 0;
+        for (const UAttributeComponent* Component : Components)
+        {
+            NumMatching += Component->GetAttributeValue(AttributeTags::Mana) == 14.0f && Component->GetAttributeValue(AttributeTags::Stamina) == 0.0f ? 1 : 0;
+        }
+        TestEqual(TEXT("Every chunk regenerates its components once per elapsed period"), NumMatching, Components.Num());
+        TestEqual(TEXT("Reaching the minimum is reported once per component"), Listener->NumThresholdsReached, Components.Num());
+        TestEqual(TEXT("Timed modifier expires in the update phase"), Components[0]->GetAttributeValue(AttributeTags::Health), 50.0f);
+    }
+
+    EnabledVariable->Set(bWasEnabled, ECVF_SetByCode);
+    ChunkSizeVariable->Set(OldChunkSize, ECVF_SetByCode);
+    return true;
+}
+
+#endif
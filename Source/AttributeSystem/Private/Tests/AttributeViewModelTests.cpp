@@ -0,0 +1,65 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#include "AttributeSystemTestHelpers.h"
+#include "AttributeTestListener.h"
+#include "AttributeViewModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeViewModelBindingTest, "AttributeSystem.ViewModel.Binding", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeViewModelBindingTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+    UAttributeViewModel* ViewModel = NewObject<UAttributeViewModel>();
+    ViewModel->OnUpdated.AddDynamic(Listener, &UAttributeTestListener::HandleViewUpdated);
+
+    ViewModel->SetAttributes({ AttributeTags::Health, AttributeTags::Mana });
+    TestEqual(TEXT("No update without a component"), Listener->NumViewUpdates, 0);
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 40.0f), MakeAttribute(AttributeTags::Mana, 80.0f, 0.0f, 200.0f) });
+    ViewModel->SetComponent(Component);
+    TestEqual(TEXT("Binding a ready component refreshes once"), Listener->NumViewUpdates, 1);
+    TestEqual(TEXT("Bound value is read"), ViewModel->GetValue(AttributeTags::Health), 40.0f);
+    TestEqual(TEXT("Normalized value is read"), ViewModel->GetNormalized(AttributeTags::Mana), 0.4f);
+
+    ViewModel->SetAttributes({ AttributeTags::Mana });
+    TestEqual(TEXT("Changing the attribute list of a bound view model refreshes"), Listener->NumViewUpdates, 2);
+    TestTrue(TEXT("Only the listed attribute is reported"), Listener->LastChangedTags.Num() == 1 && Listener->LastChangedTags[0] == AttributeTags::Mana);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeViewModelThrottleTest, "AttributeSystem.ViewModel.Throttle", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAttributeViewModelThrottleTest::RunTest(const FString& Parameters)
+{
+    using namespace AttributeSystemTests;
+
+    FTestWorld World;
+    UAttributeComponent* Component = World.SpawnComponent({ MakeAttribute(AttributeTags::Health, 50.0f) });
+
+    UAttributeTestListener* Listener = NewObject<UAttributeTestListener>();
+    UAttributeViewModel* ViewModel = UAttributeViewModel::CreateAttributeViewModel(nullptr, Component, { AttributeTags::Health }, 0.5f, 0.01f);
+    ViewModel->OnUpdated.AddDynamic(Listener, &UAttributeTestListener::HandleViewUpdated);
+
+    const double StartTime = 100.0;
+    TestTrue(TEXT("First flush goes through"), ViewModel->FlushQueued(StartTime));
+
+    Component->SetAttributeValue(AttributeTags::Health, 30.0f, EAttributeOperation::Override);
+    Component->SetAttributeValue(AttributeTags::Health, 20.0f, EAttributeOperation::Override);
+    TestEqual(TEXT("Changes are not pushed synchronously"), ViewModel->GetValue(AttributeTags::Health), 50.0f);
+    TestFalse(TEXT("Flush inside the interval is deferred"), ViewModel->FlushQueued(StartTime + 0.1));
+    TestTrue(TEXT("Flush after the interval goes through"), ViewModel->FlushQueued(StartTime + 0.6));
+    TestEqual(TEXT("Coalesced changes push the latest value"), ViewModel->GetValue(AttributeTags::Health), 20.0f);
+    TestEqual(TEXT("Coalesced changes are pushed once"), Listener->NumViewUpdates, 1);
+
+    Component->SetAttributeValue(AttributeTags::Health, 20.001f, EAttributeOperation::Override);
+    ViewModel->FlushQueued(StartTime + 2.0);
+    TestEqual(TEXT("Changes within epsilon are not pushed"), Listener->NumViewUpdates, 1);
+    return true;
+}
+
+#endif
@@ -7,14 +7,24 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "AttributeData.h"
+#include "AttributeRegistry.h"
+#include "AttributeFixedPoint.h"
 #include "AttributeComponent.generated.h"
 
+enum class EAttributeChangeSource : uint8;
+struct FStreamableHandle;
+struct FAttributeUpdateEvent;
+class UAttributeQuerySubsystem;
+class UAttributeUpdateSubsystem;
+class UAttributeDormantStateSubsystem;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributeChanged, FGameplayTag, AttributeTag, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributeAdded, FGameplayTag, AttributeTag, float, InitialValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttributeRemoved, FGameplayTag, AttributeTag);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributeThresholdReached, FGameplayTag, AttributeTag, float, CurrentValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPreAttributeChanged, FGameplayTag, AttributeTag, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInitializeAttributes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttributesReady);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeath);
 
 
@@ -44,11 +54,37 @@ struct FAttributeModifier
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes")
     float Duration; // -1 for permanent, >0 for temporary
 
+    // Resolved when the modifier is applied; active modifiers are matched by id rather than by tag
+    UPROPERTY()
+    FAttributeId AttributeId;
+
+    // Assigned when applied, so expiry and removal affect exactly one of several identical modifiers
+    UPROPERTY()
+    uint32 Handle;
+
     FAttributeModifier()
-        : AttributeTag(), Value(0.0f), Duration(-1.0f) {}
+        : AttributeTag(), Value(0.0f), Duration(-1.0f), Handle(0) {}
 
     FAttributeModifier(FGameplayTag InAttributeTag, float InValue, float InDuration = -1.0f)
-        : AttributeTag(InAttributeTag), Value(InValue), Duration(InDuration) {}
+        : AttributeTag(InAttributeTag), Value(InValue), Duration(InDuration), Handle(0) {}
+};
+
+USTRUCT(BlueprintType)
+struct FAttributeCost
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes")
+    FGameplayTag AttributeTag;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes", meta = (ClampMin = "0"))
+    float Amount;
+
+    FAttributeCost()
+        : AttributeTag(), Amount(0.0f) {}
+
+    FAttributeCost(FGameplayTag InAttributeTag, float InAmount)
+        : AttributeTag(InAttributeTag), Amount(InAmount) {}
 };
 
 UCLASS(ClassGroup = (Custom), DisplayName = "AttributeComponent", meta = (BlueprintSpawnableComponent))
@@ -56,23 +92,52 @@ class ATTRIBUTESYSTEM_API UAttributeComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    // Lets the automation tests put a component into its loading state without streaming a real asset
+    friend struct FAttributeComponentTestAccess;
+
 public:
     UAttributeComponent(const FObjectInitializer& ObjectInitializer);
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes")
     class UAttributeData* AttributeDataAsset;
 
+    // Used when AttributeDataAsset is not set; streamed in asynchronously on BeginPlay instead of blocking the game thread
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes")
+    TSoftObjectPtr<UAttributeData> SoftAttributeDataAsset;
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void LoadAttributesFromDataAsset();
 
+    // Loads AttributeDataAsset, or SoftAttributeDataAsset through the streamable manager if it is not resident yet
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    void RequestAttributeDataLoad();
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Attributes")
+    bool AreAttributesReady() const { return bAttributesReady; }
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     float GetAttributeValue(const FGameplayTag& AttributeTag) const;
 
+    // Id-based accessors skip the tag lookup; resolve the id once with GetAttributeId and cache it
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Attributes")
+    static FAttributeId GetAttributeId(const FGameplayTag& AttributeTag);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    float GetAttributeValueById(FAttributeId AttributeId) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    void SetAttributeValueById(FAttributeId AttributeId, float Value, EAttributeOperation Operation = EAttributeOperation::Override);
+
+    const FAttribute* FindAttribute(FAttributeId AttributeId) const;
+    const FAttribute* FindAttribute(const FGameplayTag& AttributeTag) const;
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void SetAttributeValue(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation = EAttributeOperation::Override);
 
@@ -82,6 +147,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void IncreaseAttributeValue(const FGameplayTag& AttributeTag, float Amount);
 
+    /**
+     * Pays all costs together, or none of them: fails without side effects if any attribute is missing or would drop
+     * below its MinValue. Costs on the same attribute add up. Change notifications are sent once all costs are paid.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    bool TryConsume(const TArray<FAttributeCost>& Costs);
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Attributes")
+    bool CanAfford(const TArray<FAttributeCost>& Costs) const;
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void SetAttributeMinValue(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation = EAttributeOperation::Override);
 
@@ -106,6 +181,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     TMap<FGameplayTag, FAttribute> GetAttributeMap() const;
 
+    /** Visits every attribute whose tag matches ParentTag, i.e. ParentTag itself and all tags below it, in data asset order. */
+    void ForEachAttributeInGroup(const FGameplayTag& ParentTag, TFunctionRef<void(const FAttribute&)> Visitor) const;
+
+    // Replaces the contents of OutAttributes with the attributes matching ParentTag; returns how many were found
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    int32 GetAttributesInGroup(const FGameplayTag& ParentTag, TArray<FAttribute>& OutAttributes) const;
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Attributes")
+    int32 GetNumAttributesInGroup(const FGameplayTag& ParentTag) const;
+
+    /** Applies one operation to every attribute matching ParentTag, e.g. Multiply by 0.9 on Attribute.Resist to reduce all resists by 10%. */
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    void SetGroupAttributeValue(const FGameplayTag& ParentTag, float Value, EAttributeOperation Operation);
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void SetUseRegen(const FGameplayTag& AttributeTag, bool bUseRegen);
 
@@ -154,6 +243,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "AttributeSystem|Attributes")
     FOnInitializeAttributes OnInitializeAttributes;
 
+    UPROPERTY(BlueprintAssignable, Category = "AttributeSystem|Attributes")
+    FOnAttributesReady OnAttributesReady;
+
     UPROPERTY(BlueprintAssignable, Category = "AttributeSystem|Attributes")
     FOnDeath OnDeath;
 
@@ -166,15 +258,35 @@ private:
     UPROPERTY(Transient, BlueprintReadOnly, Category = "AttributeSystem|Attributes", meta = (AllowPrivateAccess = "true"))
     TArray<FAttribute> Attributes;
 
-    TMap<FGameplayTag, FAttribute> AttributeMap;
+    // Parallel to Attributes
+    TArray<FAttributeId> AttributeIds;
+    TArray<FTimerHandle> RegenTimers;
+
+    // Slot in Attributes for every FAttributeId index, INDEX_NONE if this component does not have the attribute
+    TArray<int32> SlotsById;
+
+    struct FAttributeGroupRange
+    {
+        int32 Start;
+        int32 Num;
+    };
+
+    // Slots of every attribute tag and all of its parent tags, stored contiguously per group in GroupSlots
+    TMap<FGameplayTag, FAttributeGroupRange> GroupRanges;
+    TArray<int32> GroupSlots;
+
+    void BuildGroupIndex();
+    TConstArrayView<int32> FindGroupSlots(const FGameplayTag& ParentTag) const;
 
-    void InitializeAttributeMap();
-    void CheckRegenStatus(const FGameplayTag& AttributeTag);
+    void InitializeAttributeSlots();
+    int32 FindSlot(FAttributeId AttributeId) const;
+    void CheckRegenStatus(int32 Slot);
+    void StartRegen(int32 Slot);
+    void StopRegen(int32 Slot);
+    void StopAllRegen();
     void StartRegenTimer();
     void RegenerateAttributes();
 
-    TMap<FGameplayTag, FTimerHandle> RegenTimers;
-
 public:
 
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
@@ -191,9 +303,155 @@ public:
 
 private:
 
-    void SetAttributeValueInternal(const FGameplayTag& AttributeTag, float Value, EAttributeOperation Operation);
+    void SetAttributeValueInternal(FAttributeId AttributeId, float Value, EAttributeOperation Operation, bool bLogChange = true);
+
+    friend class UAttributeEffectSubsystem;
+
+    // Applies the summed ticks of periodic effects without logging every change; bCheckDeath behaves like DecreaseHealth
+    void ApplyEffectDelta(FAttributeId AttributeId, float Delta, bool bCheckDeath);
+
+    // Registers unknown tags while the data asset is streaming so queued writes can be replayed against it
+    FAttributeId ResolveAttributeId(const FGameplayTag& AttributeTag) const;
+
+    // Removes one active modifier matching both id and value
+    void RemoveModifierById(FAttributeId AttributeId, float ModifierValue);
+    void RemoveModifierByHandle(uint32 Handle);
+
+    // Total cost per slot, most cost lists touch only a few attributes
+    using FSlotCostArray = TArray<TPair<int32, float>, TInlineAllocator<8>>;
+    bool ValidateCosts(const TArray<FAttributeCost>& Costs, FSlotCostArray& OutSlotCosts) const;
+
+    void OnAttributeDataLoaded();
+    void MarkAttributesReady();
+
+    enum class EPendingOperationType : uint8
+    {
+        Value,
+        GroupValue,
+        MinValue,
+        MaxValue,
+        UseRegen,
+        ApplyModifier,
+        RemoveModifier,
+        AddAttribute,
+        RemoveAttribute,
+        ResetAll,
+        DeathCheck,
+        LoadFromSlot
+    };
+
+    struct FPendingAttributeOperation
+    {
+        EPendingOperationType Type;
+        FAttributeId AttributeId;
+        // Non-zero enables regen for UseRegen
+        float Value;
+        EAttributeOperation Operation;
+        // Modifier duration for ApplyModifier
+        float Duration;
+        // Parent tag for GroupValue, resolved against the loaded attributes on replay
+        FGameplayTag GroupTag;
+    };
+
+    void QueuePendingOperation(EPendingOperationType Type, FAttributeId AttributeId, float Value = 0.0f, EAttributeOperation Operation = EAttributeOperation::Override, float Duration = 0.0f, const FGameplayTag& GroupTag = FGameplayTag());
+    void ReplayPendingOperation(const FPendingAttributeOperation& Operation);
+
+    // Broadcasts OnDeath once health is depleted
+    void CheckDeath();
+
+    // Every mutation made while the data asset is still streaming in, replayed in call order once the attributes are ready
+    TArray<FPendingAttributeOperation> PendingOperations;
+    // Attributes of queued AddAttribute operations, consumed in the same order
+    TArray<FAttribute> PendingAttributes;
+    // Slot name and user index of queued LoadFromSlot operations, consumed in the same order
+    TArray<TPair<FString, int32>> PendingLoadSlots;
+
+    TSharedPtr<FStreamableHandle> AttributeDataLoadHandle;
+    bool bAttributesReady;
+    bool bAttributesLoading;
+
+    // Feeds a value change to the query index, Insights trace and telemetry recorder
+    void NotifyAttributeChange(int32 Slot, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source);
+
+    // Trace and telemetry part of NotifyAttributeChange; safe to call from the parallel update phase
+    void RecordAttributeChange(int32 Slot, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source);
+
+    void SyncQueryIndex();
+
+    static float ComputeNormalized(const FAttribute& Attribute);
+
+    UPROPERTY(Transient)
+    TObjectPtr<UAttributeQuerySubsystem> QuerySubsystem;
+
+    // Set while registered with the parallel update phase, which then replaces the regen and modifier timers
+    UPROPERTY(Transient)
+    TObjectPtr<UAttributeUpdateSubsystem> UpdateSubsystem;
+
+    struct FTimedModifier
+    {
+        uint32 Handle;
+        FAttributeId AttributeId;
+        float Value;
+        // World time in seconds
+        double ExpireTime;
+    };
+
+    // Update phase state; RegenElapsed is parallel to Attributes
+    TArray<float> RegenElapsed;
+    TArray<FTimedModifier> TimedModifiers;
+
+    // Tracks the expiry of a modifier with a duration; TimedModifiers is used by the update phase and dormancy capture alike
+    void ScheduleModifierExpiry(uint32 Handle, FAttributeId AttributeId, float ModifierValue, float Duration);
+
+    uint32 NextModifierHandle;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UAttributeDormantStateSubsystem> DormantSubsystem;
+
+    void CaptureDormantState();
+    void RestoreDormantState();
+
+    uint32 TelemetryActorId;
 
 public:
+    /**
+     * Lockstep mode: values are stored and combined in fixed point, regen and modifier expiry advance only through
+     * AdvanceSimulationTick, and the component never replicates. Must be set before BeginPlay.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AttributeSystem|Determinism")
+    bool bDeterministic;
+
+    // Simulation ticks per second, used to convert RegenRate and modifier Duration into tick counts
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AttributeSystem|Determinism", meta = (ClampMin = "1", EditCondition = "bDeterministic"))
+    int32 SimulationTickRate;
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Determinism")
+    void AdvanceSimulationTick();
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Determinism")
+    int64 GetSimulationTick() const { return SimulationTick; }
+
+    // Checksum of every attribute and pending modifier after the last simulation tick; compare across peers to detect desyncs
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Determinism")
+    int32 GetStateChecksum() const { return static_cast<int32>(StateChecksum); }
+
+    /** Regen, modifier expiry and threshold detection for the parallel update phase; may run on any worker thread and only touches this component. */
+    void UpdateAttributesParallel(float DeltaTime, double CurrentTime, TArray<FAttributeUpdateEvent>& OutEvents);
+
+    /** Game thread half of the update phase: broadcasts and bookkeeping for an event produced by UpdateAttributesParallel. */
+    void DispatchUpdateEvent(const FAttributeUpdateEvent& Event);
+
+    // Keep attribute and modifier state in memory while the owner is streamed out, and restore it when the owner streams back in
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AttributeSystem|Dormancy")
+    bool bPersistWhenStreamedOut;
+
+    // Key in the dormant state store; placed actors default to their path name, spawned actors need an explicit id
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Dormancy", meta = (EditCondition = "bPersistWhenStreamedOut"))
+    FName DormantStateId;
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Dormancy")
+    FName GetDormantStateId() const;
+
     UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
     void SaveAttributes(FString SlotName = "AttributeSaveSlot", int32 Index = 0);
 
@@ -203,4 +461,35 @@ public:
 private:
     FString DefaultSaveSlotName;
     uint32 DefaultUserIndex;
+
+    // Authoritative values in deterministic mode, parallel to Attributes; the float fields are kept as a mirror for reads
+    struct FDeterministicAttributeState
+    {
+        FAttributeFixed Value;
+        FAttributeFixed MinValue;
+        FAttributeFixed MaxValue;
+        FAttributeFixed RegenValue;
+        // INDEX_NONE when RegenRate <= 0, which never regenerates, like the timer and update phase paths
+        int32 RegenPeriodTicks;
+        int64 NextRegenTick;
+    };
+
+    struct FDeterministicModifier
+    {
+        uint32 Handle;
+        FAttributeId AttributeId;
+        float Value;
+        int64 ExpireTick;
+    };
+
+    TArray<FDeterministicAttributeState> DeterministicStates;
+    TArray<FDeterministicModifier> DeterministicModifiers;
+    int64 SimulationTick;
+    uint32 StateChecksum;
+
+    void InitializeDeterministicState(int32 Slot);
+    int32 SecondsToSimulationTicks(float Seconds) const;
+    uint32 ComputeStateChecksum() const;
+
+    static FAttributeFixed ApplyFixedOperation(FAttributeFixed Current, float Operand, EAttributeOperation Operation);
 };
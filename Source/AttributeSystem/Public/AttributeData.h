@@ -51,4 +51,6 @@ class ATTRIBUTESYSTEM_API UAttributeData : public UDataAsset
 public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Attributes")
     TArray<FAttribute> Attributes;
+
+    virtual void PostLoad() override;
 };
@@ -0,0 +1,42 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AttributeData.h"
+#include "AttributeDataPreloadSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttributeDataPreloaded);
+
+/**
+ * Streams attribute data assets in ahead of time (e.g. during level load) and keeps them resident for the
+ * lifetime of the world, so components referencing them through SoftAttributeDataAsset initialize without hitches.
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeDataPreloadSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    void PreloadAttributeData(const TArray<TSoftObjectPtr<UAttributeData>>& DataAssets);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Attributes")
+    void ReleasePreloadedAttributeData();
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Attributes")
+    bool IsPreloadComplete() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "AttributeSystem|Attributes")
+    FOnAttributeDataPreloaded OnAttributeDataPreloaded;
+
+private:
+    void HandlePreloadCompleted();
+
+    TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
+};
@@ -0,0 +1,80 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AttributeRegistry.h"
+#include "AttributeDormantStateSubsystem.generated.h"
+
+struct FDormantAttributeValue
+{
+    FAttributeId AttributeId;
+    bool bUseRegen;
+    float Value;
+    float MinValue;
+    float MaxValue;
+};
+
+struct FDormantAttributeModifier
+{
+    FAttributeId AttributeId;
+    float Value;
+    // Seconds left when captured; negative for permanent modifiers
+    float RemainingTime;
+};
+
+/** Packed attribute and modifier state of one streamed-out actor. */
+struct FAttributeDormantState
+{
+    double CaptureTime = 0.0;
+    TArray<FDormantAttributeValue> Values;
+    TArray<FDormantAttributeModifier> Modifiers;
+};
+
+/**
+ * In-memory store for the attribute state of actors that were streamed out, keyed by a stable actor id.
+ *
+ * UAttributeComponent captures its state here when it is removed from the world and takes it back once its
+ * attributes are ready after streaming in again, fast-forwarding regen and modifier durations over the time it
+ * was dormant. Use SaveDormantStates/LoadDormantStates to persist the whole store with a world save.
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeDormantStateSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    void StoreState(FName ActorId, FAttributeDormantState&& State);
+
+    /** Removes the state stored for ActorId; OutElapsed is the number of seconds it was dormant. */
+    bool TakeState(FName ActorId, FAttributeDormantState& OutState, double& OutElapsed);
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Dormancy")
+    bool HasState(FName ActorId) const { return States.Contains(ActorId); }
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Dormancy")
+    int32 GetNumStates() const { return States.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Dormancy")
+    void ClearStates();
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Dormancy")
+    TArray<uint8> SaveDormantStates() const;
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Dormancy")
+    bool LoadDormantStates(const TArray<uint8>& Data);
+
+    /** Attribute ids are written together with their tags, so data stays loadable if the registry changes between builds. */
+    void SerializeDormantStates(FArchive& Ar);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    double GetCurrentTime() const;
+
+    TMap<FName, FAttributeDormantState> States;
+};
@@ -0,0 +1,193 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "AttributeRegistry.h"
+#include "AttributeEffectSubsystem.generated.h"
+
+class UAttributeComponent;
+class UCurveFloat;
+
+UENUM(BlueprintType)
+enum class EPeriodicEffectStacking : uint8
+{
+    // Every application runs as its own effect
+    Independent UMETA(DisplayName = "Independent"),
+    // Reapplying from the same source restarts the duration of the running effect
+    RefreshDuration UMETA(DisplayName = "Refresh Duration"),
+    // Reapplying from the same source adds a stack, up to MaxStacks, and restarts the duration
+    StackMagnitude UMETA(DisplayName = "Stack Magnitude")
+};
+
+/** Damage or heal over time applied to one attribute. */
+USTRUCT(BlueprintType)
+struct FPeriodicAttributeEffect
+{
+    GENERATED_BODY()
+
+    // Identifies the effect for stacking and RemovePeriodicEffectsByTag
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    FGameplayTag EffectTag;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    FGameplayTag AttributeTag;
+
+    // Added to the attribute every period; negative for damage over time
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    float Magnitude = 0.0f;
+
+    // Optional; if set, each period applies Magnitude scaled by this curve evaluated at the seconds elapsed since application
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    TObjectPtr<UCurveFloat> MagnitudeCurve = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects", meta = (ClampMin = "0.01"))
+    float Period = 1.0f;
+
+    // Seconds; <= 0 runs until removed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    float Duration = -1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    EPeriodicEffectStacking Stacking = EPeriodicEffectStacking::Independent;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects", meta = (ClampMin = "1", EditCondition = "Stacking == EPeriodicEffectStacking::StackMagnitude"))
+    int32 MaxStacks = 1;
+
+    // Instigator; only held weakly once the effect is applied
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|Effects")
+    TObjectPtr<UObject> Source = nullptr;
+};
+
+USTRUCT(BlueprintType)
+struct FPeriodicEffectHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Id = INDEX_NONE;
+
+    bool IsValid() const { return Id != INDEX_NONE; }
+};
+
+// Target, effect tag and source; pointers are only compared, never dereferenced
+using FPeriodicEffectStackKey = TTuple<const UAttributeComponent*, FGameplayTag, const UObject*>;
+
+/** Running instance of a periodic effect, owned by UAttributeEffectSubsystem. */
+USTRUCT()
+struct FActivePeriodicEffect
+{
+    GENERATED_BODY()
+
+    int32 Id = INDEX_NONE;
+    TWeakObjectPtr<UAttributeComponent> Target;
+    TWeakObjectPtr<UObject> Source;
+    FAttributeId AttributeId;
+    FGameplayTag EffectTag;
+    float Magnitude = 0.0f;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UCurveFloat> MagnitudeCurve = nullptr;
+
+    EPeriodicEffectStacking Stacking = EPeriodicEffectStacking::Independent;
+    int32 MaxStacks = 1;
+    int32 StackCount = 1;
+    double StartTime = 0.0;
+    double EndTime = -1.0;
+    // Each effect keeps the phase it was applied with, one period after application
+    double NextTickTime = 0.0;
+    FPeriodicEffectStackKey StackKey;
+};
+
+/** All running effects sharing one period. */
+USTRUCT()
+struct FPeriodicEffectBatch
+{
+    GENERATED_BODY()
+
+    float Period = 1.0f;
+    // Earliest NextTickTime of any effect in the batch, so batches with nothing due are skipped
+    double NextTickTime = 0.0;
+
+    UPROPERTY(Transient)
+    TArray<FActivePeriodicEffect> Effects;
+};
+
+/**
+ * Runs every periodic attribute effect in the world.
+ *
+ * Effects are grouped into batches by period; each effect ticks on its own phase, one period after it was applied,
+ * and a batch is skipped until its earliest effect is due. All ticks due in a frame are summed per component and
+ * attribute first and then applied in a single mutation pass, so a component sees at most one change per attribute
+ * per frame no matter how many effects target it. Deterministic components are rejected, since their attributes
+ * may only change from the simulation tick.
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeEffectSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Effects")
+    FPeriodicEffectHandle ApplyPeriodicEffect(UAttributeComponent* Target, const FPeriodicAttributeEffect& Effect);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Effects")
+    bool RemovePeriodicEffect(FPeriodicEffectHandle Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Effects")
+    int32 RemovePeriodicEffectsByTag(UAttributeComponent* Target, FGameplayTag EffectTag);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Effects")
+    int32 RemoveAllPeriodicEffects(UAttributeComponent* Target);
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Effects")
+    int32 GetStackCount(FPeriodicEffectHandle Handle) const;
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|Effects")
+    int32 GetNumActiveEffects() const { return EffectLocations.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FEffectLocation
+    {
+        int32 Batch;
+        int32 Index;
+    };
+
+    struct FPendingMutation
+    {
+        TWeakObjectPtr<UAttributeComponent> Target;
+        FAttributeId AttributeId;
+        float Delta;
+    };
+
+    int32 FindOrAddBatch(float Period);
+    void AddEffect(FActivePeriodicEffect&& Effect, float Period);
+    // Takes the effect out of its batch without ending it, keeping EffectLocations of the remaining effects valid
+    void DetachEffectAt(int32 Batch, int32 Index);
+    void RemoveEffectAt(int32 Batch, int32 Index);
+    void TickBatch(int32 Batch, double CurrentTime);
+    void AddMutation(UAttributeComponent* Target, FAttributeId AttributeId, float Delta);
+    void ApplyMutations();
+
+    double GetCurrentTime() const;
+
+    UPROPERTY(Transient)
+    TArray<FPeriodicEffectBatch> Batches;
+
+    TMap<int32, FEffectLocation> EffectLocations;
+    TMap<FPeriodicEffectStackKey, int32> StackableEffects;
+    int32 NextEffectId = 0;
+
+    // Reused every frame
+    TArray<FPendingMutation> PendingMutations;
+    TMap<TPair<const UAttributeComponent*, uint16>, int32> PendingMutationIndices;
+};
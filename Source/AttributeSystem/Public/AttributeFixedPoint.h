@@ -0,0 +1,58 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 48.16 signed fixed-point value used by deterministic attribute components.
+ *
+ * All arithmetic is integer-only, so results are bit-identical on every platform and compiler.
+ * Products stay exact as long as the integer parts of both operands fit in roughly +-2^31.
+ */
+struct FAttributeFixed
+{
+    static constexpr int32 FractionalBits = 16;
+    static constexpr int64 One = int64(1) << FractionalBits;
+
+    int64 Raw = 0;
+
+    static FAttributeFixed FromRaw(int64 InRaw)
+    {
+        FAttributeFixed Result;
+        Result.Raw = InRaw;
+        return Result;
+    }
+
+    // Only deterministic for identical float inputs, e.g. values authored in data assets or sent as lockstep input
+    static FAttributeFixed FromFloat(float Value)
+    {
+        return FromRaw(FMath::RoundToInt64(static_cast<double>(Value) * One));
+    }
+
+    float ToFloat() const
+    {
+        return static_cast<float>(static_cast<double>(Raw) / One);
+    }
+
+    friend FAttributeFixed operator+(FAttributeFixed A, FAttributeFixed B) { return FromRaw(A.Raw + B.Raw); }
+    friend FAttributeFixed operator-(FAttributeFixed A, FAttributeFixed B) { return FromRaw(A.Raw - B.Raw); }
+
+    friend FAttributeFixed operator*(FAttributeFixed A, FAttributeFixed B)
+    {
+        // Split A into integer and fractional parts so the intermediate products do not overflow
+        const int64 IntegerPart = (A.Raw >> FractionalBits) * B.Raw;
+        const int64 FractionalPart = ((A.Raw & (One - 1)) * B.Raw) >> FractionalBits;
+        return FromRaw(IntegerPart + FractionalPart);
+    }
+
+    // B must not be zero
+    friend FAttributeFixed operator/(FAttributeFixed A, FAttributeFixed B) { return FromRaw((A.Raw * One) / B.Raw); }
+
+    friend bool operator==(FAttributeFixed A, FAttributeFixed B) { return A.Raw == B.Raw; }
+    friend bool operator!=(FAttributeFixed A, FAttributeFixed B) { return A.Raw != B.Raw; }
+    friend bool operator<(FAttributeFixed A, FAttributeFixed B) { return A.Raw < B.Raw; }
+    friend bool operator>(FAttributeFixed A, FAttributeFixed B) { return A.Raw > B.Raw; }
+    friend bool operator<=(FAttributeFixed A, FAttributeFixed B) { return A.Raw <= B.Raw; }
+    friend bool operator>=(FAttributeFixed A, FAttributeFixed B) { return A.Raw >= B.Raw; }
+};
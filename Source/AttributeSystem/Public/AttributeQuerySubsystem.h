@@ -0,0 +1,98 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "AttributeRegistry.h"
+#include "AttributeQuerySubsystem.generated.h"
+
+class UAttributeComponent;
+
+/**
+ * World-level index over every live UAttributeComponent, bucketed by normalized attribute value per tag.
+ *
+ * Components keep the index up to date incrementally as their attributes change, so value queries cost roughly
+ * the size of their result rather than the number of actors in the world. Queries with a radius are additionally
+ * narrowed through a coarse XY grid that is rebuilt at most every AttributeSystem.Query.GridRefreshInterval seconds;
+ * the final distance test always uses the actor's current location.
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeQuerySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Components whose AttributeTag lies in [MinNormalized, MaxNormalized]; Radius <= 0 disables the spatial filter. */
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Query")
+    void QueryInRange(FGameplayTag AttributeTag, float MinNormalized, float MaxNormalized, FVector Origin, float Radius, TArray<UAttributeComponent*>& OutComponents);
+
+    /** Up to Count components with the lowest normalized AttributeTag, ordered ascending. */
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Query")
+    void FindLowest(FGameplayTag AttributeTag, int32 Count, FVector Origin, float Radius, TArray<UAttributeComponent*>& OutComponents);
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|Query")
+    int32 CountInRange(FGameplayTag AttributeTag, float MinNormalized, float MaxNormalized, FVector Origin, float Radius);
+
+    /** Called by UAttributeComponent whenever an attribute value or its range changes. */
+    void UpdateAttribute(UAttributeComponent* Component, FAttributeId AttributeId, float Normalized);
+
+    void RemoveAttribute(UAttributeComponent* Component, FAttributeId AttributeId);
+
+    void RemoveComponent(UAttributeComponent* Component);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static constexpr int32 NumBuckets = 32;
+
+    // Components are held weakly, so a component destroyed without EndPlay only leaves a dead entry behind
+    struct FIndexedEntry
+    {
+        TWeakObjectPtr<UAttributeComponent> Component;
+        float Normalized;
+    };
+
+    struct FEntryLocation
+    {
+        int32 Bucket;
+        int32 Index;
+    };
+
+    struct FTagIndex
+    {
+        TArray<FIndexedEntry> Buckets[NumBuckets];
+        TMap<TWeakObjectPtr<UAttributeComponent>, FEntryLocation> Locations;
+
+        void Add(UAttributeComponent* Component, float Normalized);
+        void Remove(UAttributeComponent* Component);
+        const FIndexedEntry* Find(UAttributeComponent* Component) const;
+    };
+
+    static int32 GetBucket(float Normalized);
+
+    const FTagIndex* FindTagIndex(const FGameplayTag& AttributeTag) const;
+
+    void RefreshGridIfStale();
+    FIntPoint GetCell(const FVector& Location) const;
+
+    /** Candidates from the grid cells overlapping the query circle, or false if that would not beat the value buckets. */
+    bool GatherSpatialCandidates(const FVector& Origin, float Radius, int32 ValueCandidateCount, TArray<UAttributeComponent*>& OutCandidates);
+
+    static bool IsWithinRadius(const UAttributeComponent* Component, const FVector& Origin, float RadiusSquared);
+
+    // Indexed by FAttributeId
+    TArray<FTagIndex> TagIndexes;
+
+    // Ids every component is indexed under, so removing a component only touches its own tag indexes
+    TMap<TWeakObjectPtr<UAttributeComponent>, TArray<FAttributeId>> RegisteredComponents;
+
+    TMap<FIntPoint, TArray<TWeakObjectPtr<UAttributeComponent>>> Grid;
+    TMap<TWeakObjectPtr<UAttributeComponent>, FIntPoint> ComponentCells;
+    float GridCellSize = 0.0f;
+    double LastGridBuildTime = -1.0;
+};
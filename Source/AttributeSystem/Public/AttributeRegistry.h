@@ -0,0 +1,91 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include <atomic>
+#include "AttributeRegistry.generated.h"
+
+/**
+ * Dense, process-wide id of an attribute tag, interned by FAttributeRegistry.
+ * Used to index component storage directly instead of hashing FGameplayTag. Ids of tags below the "Attribute" root
+ * only depend on which of those tags exist, so they match between builds of the same project and replicate as two
+ * bytes; any other tag gets a process-local id and is replicated by tag.
+ */
+USTRUCT(BlueprintType)
+struct ATTRIBUTESYSTEM_API FAttributeId
+{
+    GENERATED_BODY()
+
+    static constexpr uint16 InvalidIndex = MAX_uint16;
+
+    FAttributeId()
+        : Index(InvalidIndex) {}
+
+    explicit FAttributeId(uint16 InIndex)
+        : Index(InIndex) {}
+
+    bool IsValid() const { return Index != InvalidIndex; }
+    uint16 GetIndex() const { return Index; }
+
+    /** Looks up a tag without registering it; returns an invalid id for unknown tags. */
+    static FAttributeId FromTag(const FGameplayTag& AttributeTag);
+    FGameplayTag GetTag() const;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+    bool operator==(const FAttributeId& Other) const { return Index == Other.Index; }
+    bool operator!=(const FAttributeId& Other) const { return Index != Other.Index; }
+
+    friend uint32 GetTypeHash(const FAttributeId& AttributeId) { return AttributeId.Index; }
+
+private:
+    UPROPERTY()
+    uint16 Index;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAttributeId> : public TStructOpsTypeTraitsBase2<FAttributeId>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true
+    };
+};
+
+/**
+ * Interns every attribute tag into a dense FAttributeId.
+ *
+ * Once native tags are done being added, all tags below the "Attribute" root, plus any tag registered before that,
+ * are numbered in lexical order. That table is then frozen and lookups into it are lock-free. Tags first seen later
+ * (data assets or effects using tags outside the root) are appended on demand under a lock in load order, so only
+ * their ids can differ between runs.
+ */
+class ATTRIBUTESYSTEM_API FAttributeRegistry
+{
+public:
+    static FAttributeRegistry& Get();
+
+    FAttributeId Register(const FGameplayTag& AttributeTag);
+    FAttributeId Find(const FGameplayTag& AttributeTag) const;
+    FGameplayTag GetTag(FAttributeId AttributeId) const;
+    int32 Num() const;
+    // True for ids of the frozen table, which are the same in every process
+    bool IsStable(FAttributeId AttributeId) const;
+
+    void RegisterNativeTags();
+
+private:
+    mutable FRWLock Lock;
+    TMap<FGameplayTag, FAttributeId> IdsByTag;
+    TArray<FGameplayTag> Tags;
+
+    // Snapshot of the tags registered by RegisterNativeTags; never modified once bFrozen is set
+    TMap<FGameplayTag, FAttributeId> FrozenIdsByTag;
+    TArray<FGameplayTag> FrozenTags;
+    std::atomic<bool> bFrozen = false;
+    // Set once a tag is registered after the freeze, so misses only take the lock when there is something to find
+    std::atomic<bool> bHasLateTags = false;
+};
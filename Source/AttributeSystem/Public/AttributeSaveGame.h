@@ -15,6 +15,18 @@ class ATTRIBUTESYSTEM_API UAttributeSaveGame : public USaveGame
 {
     GENERATED_BODY()
 public:
+    // Legacy tag-keyed values, only read when loading saves written before SavedValues existed
     UPROPERTY(VisibleAnywhere, Category = "SaveGameData")
     TMap<FGameplayTag, float> SavedAttributes;
+
+    // FAttributeId indices of the saved attributes, parallel to SavedValues
+    UPROPERTY(VisibleAnywhere, Category = "SaveGameData")
+    TArray<uint16> SavedIds;
+
+    // Tag of every saved id, used to remap ids that no longer match because attribute tags were added or removed since
+    UPROPERTY(VisibleAnywhere, Category = "SaveGameData")
+    TArray<FGameplayTag> SavedTags;
+
+    UPROPERTY(VisibleAnywhere, Category = "SaveGameData")
+    TArray<float> SavedValues;
 };
@@ -0,0 +1,111 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeRegistry.h"
+#include <atomic>
+
+enum class EAttributeOperation : uint8;
+
+/** What caused an attribute change; stored alongside every telemetry record. */
+enum class EAttributeChangeSource : uint8
+{
+    Initialize,
+    Set,
+    MinValue,
+    MaxValue,
+    Modifier,
+    ModifierRemoved,
+    Regen,
+    Reset,
+    LoadFromSave,
+    RestoreDormant,
+    Consume
+};
+
+/** Fixed-size change record as written to disk. */
+struct FAttributeTelemetryRecord
+{
+    uint64 Cycles;
+    uint32 ActorId;
+    uint16 TagId;
+    uint8 Operation;
+    uint8 Source;
+    float OldValue;
+    float NewValue;
+};
+
+static_assert(sizeof(FAttributeTelemetryRecord) == 24, "FAttributeTelemetryRecord layout is part of the telemetry file format");
+
+/**
+ * Low-overhead recorder for attribute changes.
+ *
+ * Records are appended to per-thread buffers and written to a rolling binary file
+ * (Saved/Telemetry by default) by a background thread. Use ConvertToCsv, the
+ * AttributeTelemetry commandlet or the AttributeSystem.Telemetry.ToCsv console
+ * command to turn a capture into CSV.
+ */
+class ATTRIBUTESYSTEM_API FAttributeTelemetryRecorder
+{
+public:
+    static FAttributeTelemetryRecorder& Get();
+
+    static bool IsRecording() { return bRecording.load(std::memory_order_relaxed); }
+
+    bool Start(const FString& InDirectory = FString());
+    void Stop();
+
+    /** Returns a session-wide id for the actor, emitting its name into the capture. */
+    uint32 RegisterActor(const FString& ActorName);
+
+    void Record(uint32 ActorId, FAttributeId AttributeId, float OldValue, float NewValue, EAttributeOperation Operation, EAttributeChangeSource Source);
+
+    static bool ConvertToCsv(const FString& InputPath, const FString& OutputPath);
+
+    ~FAttributeTelemetryRecorder();
+
+private:
+    FAttributeTelemetryRecorder();
+
+    class FWriterRunnable;
+    friend class FWriterRunnable;
+
+    struct FThreadBuffer
+    {
+        FCriticalSection Lock;
+        TArray<FAttributeTelemetryRecord> Records;
+    };
+
+    FThreadBuffer& GetThreadBuffer();
+
+    void RunWriter();
+    void FlushBuffers();
+    bool OpenNextFile();
+    void CloseFile();
+    void WriteNames();
+
+    static std::atomic<bool> bRecording;
+
+    std::atomic<bool> bStopRequested;
+
+    FCriticalSection BuffersLock;
+    TArray<TSharedPtr<FThreadBuffer, ESPMode::ThreadSafe>> ThreadBuffers;
+
+    FCriticalSection ActorLock;
+    TArray<FString> ActorNames;
+
+    TUniquePtr<FWriterRunnable> Writer;
+    FRunnableThread* Thread;
+    FEvent* WakeEvent;
+
+    // Writer thread state
+    FArchive* FileWriter;
+    FString Directory;
+    FString BaseFileName;
+    int32 FileIndex;
+    int32 WrittenTagCount;
+    int32 WrittenActorCount;
+    uint64 StartCycles;
+    TArray<FAttributeTelemetryRecord> PendingRecords;
+};
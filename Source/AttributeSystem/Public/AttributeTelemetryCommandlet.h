@@ -0,0 +1,21 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AttributeTelemetryCommandlet.generated.h"
+
+/**
+ * Converts an attribute telemetry capture to CSV.
+ * Usage: -run=AttributeTelemetry -Input=<Capture.bin> [-Output=<Capture.csv>]
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeTelemetryCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+public:
+    UAttributeTelemetryCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
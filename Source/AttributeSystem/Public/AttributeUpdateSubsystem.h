@@ -0,0 +1,95 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AttributeRegistry.h"
+#include "AttributeUpdateSubsystem.generated.h"
+
+class UAttributeComponent;
+class UAttributeUpdateSubsystem;
+
+enum class EAttributeUpdateEvent : uint8
+{
+    Regen,
+    ThresholdReached,
+    ModifierExpired
+};
+
+/** Result of the parallel update of one component, dispatched on the game thread in the same frame. */
+struct FAttributeUpdateEvent
+{
+    UAttributeComponent* Component;
+    FAttributeId AttributeId;
+    EAttributeUpdateEvent Type;
+    float OldValue;
+    // For ModifierExpired, the value of the expired modifier
+    float NewValue;
+    // For ModifierExpired, the handle of the expired modifier
+    uint32 ModifierHandle = 0;
+};
+
+USTRUCT()
+struct FAttributeUpdateTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UAttributeUpdateSubsystem* Subsystem = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAttributeUpdateTickFunction> : public TStructOpsTypeTraitsBase2<FAttributeUpdateTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+/**
+ * Attribute update phase that replaces per-component regen and modifier timers when AttributeSystem.UpdatePhase.Enabled is set.
+ *
+ * Once per frame, in TG_PrePhysics, all registered components are split into chunks of
+ * AttributeSystem.UpdatePhase.ChunkSize and updated in parallel with ParallelFor. Each chunk only writes its own
+ * components and appends to its own event list; trace and telemetry records are written there as well. Delegates and
+ * the query index are then fed from those lists on the game thread, so the serial part of the phase costs one
+ * delegate broadcast and one query index update per changed attribute.
+ */
+UCLASS()
+class ATTRIBUTESYSTEM_API UAttributeUpdateSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static bool IsEnabled();
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    void RegisterComponent(UAttributeComponent* Component);
+    void UnregisterComponent(UAttributeComponent* Component);
+
+    void RunUpdatePhase(float DeltaTime);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void DispatchEvents();
+    void RemoveDestroyedComponents();
+
+    FAttributeUpdateTickFunction TickFunction;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UAttributeComponent>> Components;
+    TMap<const UAttributeComponent*, int32> ComponentIndices;
+
+    // One event list per chunk, kept between frames to reuse their allocations
+    TArray<TArray<FAttributeUpdateEvent>> ChunkEvents;
+};
@@ -0,0 +1,115 @@
+// Copyright (C) Thyke. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "GameplayTagContainer.h"
+#include "AttributeRegistry.h"
+#include "AttributeViewModel.generated.h"
+
+class UAttributeComponent;
+
+/** Widget-facing snapshot of a single attribute. */
+USTRUCT(BlueprintType)
+struct FAttributeViewEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AttributeSystem|View")
+    FGameplayTag AttributeTag;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AttributeSystem|View")
+    float Value = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AttributeSystem|View")
+    float MinValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AttributeSystem|View")
+    float MaxValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AttributeSystem|View")
+    float Normalized = 0.0f;
+};
+
+class UAttributeViewModel;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttributeViewUpdated, UAttributeViewModel*, ViewModel, const TArray<FGameplayTag>&, ChangedTags);
+
+/**
+ * Throttled snapshot of selected attributes of one UAttributeComponent for UMG.
+ *
+ * Attribute changes only mark the view model dirty; a shared ticker flushes every dirty view model at most once per
+ * frame (or once per UpdateInterval) and broadcasts OnUpdated only for attributes that moved by more than Epsilon.
+ * Widgets bind to OnUpdated or read the snapshot instead of polling the component in property bindings.
+ */
+UCLASS(BlueprintType)
+class ATTRIBUTESYSTEM_API UAttributeViewModel : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|View", meta = (DefaultToSelf = "Owner", HidePin = "Owner"))
+    static UAttributeViewModel* CreateAttributeViewModel(UObject* Owner, UAttributeComponent* Component, const TArray<FGameplayTag>& AttributeTags, float InUpdateInterval = 0.0f, float InEpsilon = 0.001f);
+
+    // Seconds between pushes; 0 pushes at most once per frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|View", meta = (ClampMin = "0"))
+    float UpdateInterval = 0.0f;
+
+    // Minimum change of a displayed value before it is pushed; reaching the min or max value is always pushed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AttributeSystem|View", meta = (ClampMin = "0"))
+    float Epsilon = 0.001f;
+
+    UPROPERTY(BlueprintAssignable, Category = "AttributeSystem|View")
+    FOnAttributeViewUpdated OnUpdated;
+
+    // Rebinds the view model, e.g. when a raid frame is reused for another player
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|View")
+    void SetComponent(UAttributeComponent* InComponent);
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|View")
+    UAttributeComponent* GetComponent() const { return Component.Get(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|View")
+    void SetAttributes(const TArray<FGameplayTag>& AttributeTags);
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|View")
+    const TArray<FAttributeViewEntry>& GetEntries() const { return Entries; }
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|View")
+    bool GetEntry(FGameplayTag AttributeTag, FAttributeViewEntry& OutEntry) const;
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|View")
+    float GetValue(FGameplayTag AttributeTag) const;
+
+    UFUNCTION(BlueprintPure, Category = "AttributeSystem|View")
+    float GetNormalized(FGameplayTag AttributeTag) const;
+
+    // Pushes the current component values immediately, ignoring UpdateInterval and Epsilon
+    UFUNCTION(BlueprintCallable, Category = "AttributeSystem|View")
+    void ForceRefresh();
+
+    /** Called by the shared ticker; returns false if UpdateInterval has not elapsed yet and the view model should stay queued. */
+    bool FlushQueued(double CurrentTime);
+
+    virtual void BeginDestroy() override;
+
+private:
+    UFUNCTION()
+    void HandleAttributeChanged(FGameplayTag AttributeTag, float NewValue);
+
+    void MarkDirty();
+    void Refresh(bool bForce);
+
+    TWeakObjectPtr<UAttributeComponent> Component;
+
+    UPROPERTY(Transient)
+    TArray<FAttributeViewEntry> Entries;
+
+    // Parallel to Entries
+    TArray<FAttributeId> AttributeIds;
+
+    TArray<FGameplayTag> ChangedTags;
+    double LastFlushTime = -1.0;
+    bool bQueued = false;
+};